@@ -86,11 +86,11 @@ void modern_composite_example() {
     document.add_leaf("Author: MetaLoki 2.0");
     
     // 섹션 추가
-    auto& section1 = document.add_composite("Introduction");
+    auto section1 = document.add_composite("Introduction");
     section1.add_leaf("This is the introduction section");
     section1.add_leaf("It contains basic information");
     
-    auto& section2 = document.add_composite("Main Content");
+    auto section2 = document.add_composite("Main Content");
     section2.add_leaf("This is the main content");
     section2.add_composite("Subsection").add_leaf("Nested content");
     
@@ -103,7 +103,7 @@ void modern_composite_example() {
         [](const std::string& leaf) {
             std::cout << "  Leaf: " << leaf << std::endl;
         },
-        [](const std::string& name, size_t child_count) {
+        [](std::string_view name, size_t child_count) {
             std::cout << "Composite '" << name << "' with " 
                       << child_count << " children" << std::endl;
         }
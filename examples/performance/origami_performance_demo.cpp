@@ -3,10 +3,14 @@
  * @brief 실제 사용 시나리오의 성능 데모
  */
 
+#include <origami/builder.hpp>
+#include <origami/visitor.hpp>
 #include <origami/optimized_patterns.hpp>
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 using namespace metaloki::origami;
 using namespace metaloki::origami::optimized;
@@ -43,25 +47,20 @@ void performance_comparison_demo() {
     {
         auto start = std::chrono::high_resolution_clock::now();
         
-        auto optimized_doc = fast_builder<int_leaf, string_leaf>{}
-            .add_all([test_size]() {
-                std::vector<int_leaf> elements;
-                elements.reserve(test_size);
-                for (size_t i = 0; i < test_size; ++i) {
-                    elements.emplace_back(static_cast<int>(i));
-                }
-                return elements;
-            }()...)
+        std::vector<int_leaf> elements;
+        elements.reserve(test_size);
+        for (size_t i = 0; i < test_size; ++i) {
+            elements.emplace_back(static_cast<int>(i));
+        }
+        
+        auto optimized_doc = fast_builder<int_leaf, string_leaf>{"Optimized Implementation"}
+            .add_range(std::move(elements))
             .finish();
         
-        fast_visitor<int> fast_vis;
-        int sum = 0;
+        // 파티션별 단일 타입 루프 - 요소마다 variant 분기가 없다
         fast_iterator<int_leaf, string_leaf> fast_iter;
-        fast_iter.fast_for_each(*optimized_doc, [&](const auto& element) {
-            if constexpr (requires { element.value(); }) {
-                sum += element.value();
-            }
-        });
+        const int sum = fast_iter.fast_reduce<int_leaf>(*optimized_doc, 0, std::plus<>{},
+            [](const int_leaf& element) { return element.value(); });
         
         auto end = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
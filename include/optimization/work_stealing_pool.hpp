@@ -0,0 +1,228 @@
+/**
+ * @file include/optimization/work_stealing_pool.hpp
+ * @brief fork-join 용 work-stealing 스레드 풀
+ * @details 워커마다 deque 를 두고 자신의 작업은 뒤(LIFO)에서, 다른 워커의 작업은
+ *          앞(FIFO)에서 훔쳐 온다. fork 된 작업은 호출자 스택에 놓이므로 작업당 힙 할당이 없다.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace optimization {
+
+    class work_stealing_pool {
+    private:
+        /**
+         * @brief 큐에 들어가는 작업 - fork 한 스택 프레임이 소유
+         */
+        struct task_base {
+            void (*execute)(task_base*) = nullptr;
+            std::atomic<bool> finished{false};
+            std::exception_ptr error;
+        };
+
+        template<typename Function>
+        struct stack_task : task_base {
+            Function& function;
+
+            explicit stack_task(Function& f) : function(f) {
+                this->execute = [](task_base* self) {
+                    static_cast<stack_task*>(self)->function();
+                };
+            }
+        };
+
+        struct alignas(64) worker_queue {
+            std::mutex mutex;
+            std::deque<task_base*> tasks;
+        };
+
+        std::vector<std::unique_ptr<worker_queue>> queues_;
+        std::vector<std::thread> workers_;
+        std::atomic<std::size_t> pending_{0};
+        std::atomic<bool> stop_{false};
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_;
+
+        // 현재 스레드가 속한 풀과 워커 인덱스 (외부 스레드는 nullptr)
+        static inline thread_local const work_stealing_pool* current_pool_ = nullptr;
+        static inline thread_local std::size_t current_index_ = 0;
+
+    public:
+        explicit work_stealing_pool(std::size_t thread_count = std::thread::hardware_concurrency()) {
+            thread_count = std::max<std::size_t>(thread_count, 1);
+
+            // 외부(호출자) 스레드용 큐 하나를 추가로 둔다
+            queues_.reserve(thread_count + 1);
+            for (std::size_t i = 0; i <= thread_count; ++i) {
+                queues_.push_back(std::make_unique<worker_queue>());
+            }
+
+            workers_.reserve(thread_count);
+            for (std::size_t i = 0; i < thread_count; ++i) {
+                workers_.emplace_back([this, i] { worker_loop(i); });
+            }
+        }
+
+        ~work_stealing_pool() {
+            {
+                std::lock_guard lock(sleep_mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (auto& worker : workers_) {
+                worker.join();
+            }
+        }
+
+        work_stealing_pool(const work_stealing_pool&) = delete;
+        work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+        // 프로세스 공용 풀 (최초 사용 시 생성)
+        static work_stealing_pool& shared() {
+            static work_stealing_pool pool;
+            return pool;
+        }
+
+        std::size_t thread_count() const noexcept { return workers_.size(); }
+
+        // 워커별 누적 슬롯 개수 - 워커 수 + 외부 호출자 1
+        std::size_t slot_count() const noexcept { return workers_.size() + 1; }
+
+        // 현재 스레드의 슬롯 인덱스 (외부 스레드는 thread_count())
+        std::size_t current_slot() const noexcept {
+            return current_pool_ == this ? current_index_ : workers_.size();
+        }
+
+        /**
+         * @brief right 를 다른 워커가 훔쳐 갈 수 있게 내놓고 left 를 직접 실행한 뒤 합류
+         * @details 기다리는 동안 다른 작업을 대신 실행하므로 중첩 fork 에서도 교착되지 않는다
+         */
+        template<typename Left, typename Right>
+        void fork_join(Left&& left, Right&& right) {
+            stack_task<std::remove_reference_t<Right>> forked(right);
+            push(&forked);
+
+            // forked 는 이 스택 프레임에 있으므로 예외가 나도 합류한 뒤에 전파
+            std::exception_ptr left_error;
+            try {
+                left();
+            } catch (...) {
+                left_error = std::current_exception();
+            }
+
+            // 아직 아무도 가져가지 않았으면 직접 회수해 실행
+            if (!forked.finished.load(std::memory_order_acquire) && try_reclaim(&forked)) {
+                run(&forked);
+            }
+            wait_for(forked);
+
+            if (left_error) std::rethrow_exception(left_error);
+            if (forked.error) std::rethrow_exception(forked.error);
+        }
+
+    private:
+        void push(task_base* task) {
+            const std::size_t index = current_slot();
+            pending_.fetch_add(1, std::memory_order_release);
+            {
+                auto& queue = *queues_[index];
+                std::lock_guard lock(queue.mutex);
+                queue.tasks.push_back(task);
+            }
+
+            // 대기 중인 워커를 놓치지 않도록 sleep_mutex_ 를 거쳐 통지
+            { std::lock_guard lock(sleep_mutex_); }
+            wake_.notify_one();
+        }
+
+        // 자신의 큐 뒤쪽에 task 가 그대로 있으면 꺼낸다
+        bool try_reclaim(task_base* task) {
+            auto& queue = *queues_[current_slot()];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.tasks.empty() && queue.tasks.back() == task) {
+                queue.tasks.pop_back();
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        static void run(task_base* task) {
+            try {
+                task->execute(task);
+            } catch (...) {
+                task->error = std::current_exception();
+            }
+            task->finished.store(true, std::memory_order_release);
+        }
+
+        task_base* pop_or_steal(std::size_t self) {
+            if (pending_.load(std::memory_order_acquire) == 0) return nullptr;
+
+            {
+                auto& own = *queues_[self];
+                std::lock_guard lock(own.mutex);
+                if (!own.tasks.empty()) {
+                    auto* task = own.tasks.back();
+                    own.tasks.pop_back();
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    return task;
+                }
+            }
+
+            const std::size_t count = queues_.size();
+            for (std::size_t offset = 1; offset < count; ++offset) {
+                auto& victim = *queues_[(self + offset) % count];
+                std::lock_guard lock(victim.mutex);
+                if (!victim.tasks.empty()) {
+                    auto* task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    return task;
+                }
+            }
+            return nullptr;
+        }
+
+        void wait_for(const task_base& task) {
+            const std::size_t self = current_slot();
+            while (!task.finished.load(std::memory_order_acquire)) {
+                if (auto* other = pop_or_steal(self)) {
+                    run(other);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void worker_loop(std::size_t index) {
+            current_pool_ = this;
+            current_index_ = index;
+
+            while (true) {
+                if (auto* task = pop_or_steal(index)) {
+                    run(task);
+                    continue;
+                }
+
+                std::unique_lock lock(sleep_mutex_);
+                wake_.wait(lock, [this] {
+                    return stop_.load() || pending_.load(std::memory_order_acquire) > 0;
+                });
+                if (stop_) return;
+            }
+        }
+    };
+}
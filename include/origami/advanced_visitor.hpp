@@ -13,29 +13,42 @@
 
 namespace metaloki::origami {
     
+    // 순회 방식 열거형 - Derived 와 무관하게 tree_visitor 들이 같은 타입을 쓴다
+    enum class tree_traversal_mode {
+        depth_first_preorder,
+        depth_first_postorder,
+        breadth_first,
+        custom
+    };
+    
     /**
      * @brief 검색 결과 [4] "ItemList" 개념의 트리 구조 확장
-     * @details 재귀적 데이터 구조 전용 고급 Visitor
+     * @details 재귀적 데이터 구조 전용 고급 Visitor.
+     *          멤버 템플릿은 virtual 일 수 없으므로 process_leaf 재정의는 Derived(CRTP) 로 찾는다.
+     *          Derived 가 void 면 기본 구현을 쓴다. 재정의는 tree_visitor 를 friend 로 두거나 public 이어야 한다.
      */
-    template<typename ResultType = void>
+    template<typename ResultType = void, typename Derived = void>
     class tree_visitor : public visitor_base<ResultType> {
     public:
         using result_type = ResultType;
-        
-        // 순회 방식 열거형
-        enum class traversal_mode {
-            depth_first_preorder,
-            depth_first_postorder,
-            breadth_first,
-            custom
-        };
+        using traversal_mode = tree_traversal_mode;
         
     private:
         traversal_mode mode_ = traversal_mode::depth_first_preorder;
-        std::function<void(const auto&)> pre_visit_hook_;
-        std::function<void(const auto&)> post_visit_hook_;
+        // 방문 요소 타입은 visitor 에 고정되지 않으므로 훅은 인자 없이 호출한다
+        std::function<void()> pre_visit_hook_;
+        std::function<void()> post_visit_hook_;
         std::vector<result_type> results_;
         
+        // 재정의를 찾을 실제 visitor
+        decltype(auto) self() {
+            if constexpr (std::is_void_v<Derived>) {
+                return *this;
+            } else {
+                return static_cast<Derived&>(*this);
+            }
+        }
+        
     public:
         // 순회 방식 설정
         void set_traversal_mode(traversal_mode mode) { mode_ = mode; }
@@ -54,15 +67,15 @@ namespace metaloki::origami {
         // 검색 결과 [4] "단일데이터" 처리 (Leaf)
         template<typename ValueType>
         result_type visit(const leaf<ValueType>& leaf_element) {
-            if (pre_visit_hook_) pre_visit_hook_(leaf_element);
+            if (pre_visit_hook_) pre_visit_hook_();
             
-            result_type result = process_leaf(leaf_element);
+            result_type result = self().process_leaf(leaf_element);
             
             if constexpr (!std::is_void_v<result_type>) {
                 results_.push_back(result);
             }
             
-            if (post_visit_hook_) post_visit_hook_(leaf_element);
+            if (post_visit_hook_) post_visit_hook_();
             
             if constexpr (!std::is_void_v<result_type>) {
                 return result;
@@ -70,13 +83,13 @@ namespace metaloki::origami {
         }
         
         // 검색 결과 [4] "집합데이터" 처리 (Composite)
-        template<Component... ComponentTypes>
-        result_type visit(const composite<ComponentTypes...>& composite_element) {
-            if (pre_visit_hook_) pre_visit_hook_(composite_element);
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
+            if (pre_visit_hook_) pre_visit_hook_();
             
-            result_type result = process_composite(composite_element);
+            result_type result = self().process_composite(composite_element);
             
-            if (post_visit_hook_) post_visit_hook_(composite_element);
+            if (post_visit_hook_) post_visit_hook_();
             
             if constexpr (!std::is_void_v<result_type>) {
                 return result;
@@ -95,15 +108,15 @@ namespace metaloki::origami {
     protected:
         // 파생 클래스에서 구현할 메서드들
         template<typename ValueType>
-        virtual result_type process_leaf(const leaf<ValueType>& leaf_element) {
+        result_type process_leaf(const leaf<ValueType>&) {
             // 기본 구현: 아무것도 하지 않음
             if constexpr (!std::is_void_v<result_type>) {
                 return result_type{};
             }
         }
         
-        template<Component... ComponentTypes>
-        virtual result_type process_composite(const composite<ComponentTypes...>& composite_element) {
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type process_composite(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
             // 기본 구현: 자식들을 순회하며 방문
             result_type aggregate_result{};
             
@@ -128,16 +141,16 @@ namespace metaloki::origami {
         }
         
     private:
-        template<Component... ComponentTypes>
-        result_type visit_depth_first_preorder(const composite<ComponentTypes...>& composite_element) {
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit_depth_first_preorder(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
             result_type result{};
             
             for (const auto& child : composite_element.children()) {
                 std::visit([this, &result](const auto& child_element) {
                     if constexpr (!std::is_void_v<result_type>) {
-                        result = this->visit(child_element);
+                        result = self().visit(child_element);
                     } else {
-                        this->visit(child_element);
+                        self().visit(child_element);
                     }
                 }, child);
             }
@@ -147,14 +160,14 @@ namespace metaloki::origami {
             }
         }
         
-        template<Component... ComponentTypes>
-        result_type visit_depth_first_postorder(const composite<ComponentTypes...>& composite_element) {
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit_depth_first_postorder(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
             // 후위 순회: 자식 먼저, 그 다음 부모
             return visit_depth_first_preorder(composite_element); // 단순화된 구현
         }
         
-        template<Component... ComponentTypes>
-        result_type visit_breadth_first(const composite<ComponentTypes...>& composite_element) {
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit_breadth_first(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
             std::queue<std::variant<ComponentTypes...>> visit_queue;
             
             // 현재 레벨의 모든 자식을 큐에 추가
@@ -170,9 +183,9 @@ namespace metaloki::origami {
                 
                 std::visit([this, &visit_queue, &result](const auto& element) {
                     if constexpr (!std::is_void_v<result_type>) {
-                        result = this->visit(element);
+                        result = self().visit(element);
                     } else {
-                        this->visit(element);
+                        self().visit(element);
                     }
                     
                     // 복합 요소인 경우 자식들을 큐에 추가
@@ -189,8 +202,8 @@ namespace metaloki::origami {
             }
         }
         
-        template<Component... ComponentTypes>
-        result_type visit_custom(const composite<ComponentTypes...>& composite_element) {
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit_custom(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
             // 사용자 정의 순회 (기본은 DFS)
             return visit_depth_first_preorder(composite_element);
         }
@@ -202,12 +215,20 @@ namespace metaloki::origami {
     
     // 트리의 모든 수치 값을 수집하는 Visitor
     template<typename ValueType>
-    class collect_values_visitor : public tree_visitor<std::vector<ValueType>> {
+    class collect_values_visitor : public tree_visitor<std::vector<ValueType>, collect_values_visitor<ValueType>> {
+        friend class tree_visitor<std::vector<ValueType>, collect_values_visitor<ValueType>>;
+        
     public:
         using result_type = std::vector<ValueType>;
         
     protected:
-        result_type process_leaf(const leaf<ValueType>& leaf_element) override {
+        // 다른 leaf 타입은 기본 구현(빈 결과)
+        template<typename OtherType>
+        result_type process_leaf(const leaf<OtherType>&) {
+            return {};
+        }
+        
+        result_type process_leaf(const leaf<ValueType>& leaf_element) {
             return {leaf_element.value()};
         }
     };
@@ -226,11 +247,19 @@ namespace metaloki::origami {
             current_depth_++;
             max_depth_ = std::max(max_depth_, current_depth_);
             
-            auto result = tree_visitor<size_t>::visit(element);
+            tree_visitor<size_t>::visit(element);
             
             current_depth_--;
             return max_depth_;
         }
+        
+        // composite 서브트리 깊이는 캐시된 집계값 사용
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
+            const size_t depth = composite_element.template aggregate<aggregates::max_depth>();
+            max_depth_ = std::max(max_depth_, current_depth_ + depth);
+            return max_depth_;
+        }
     };
     
     // 노드 개수를 세는 Visitor
@@ -248,6 +277,13 @@ namespace metaloki::origami {
             return count_;
         }
         
+        // composite 서브트리 노드 수는 캐시된 집계값 사용
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
+            count_ += composite_element.template aggregate<aggregates::count>();
+            return count_;
+        }
+        
         size_t get_total_count() const { return count_; }
         void reset() { count_ = 0; }
     };
@@ -0,0 +1,235 @@
+/**
+ * @file include/origami/aggregates.hpp
+ * @brief composite 서브트리 집계(monoid) 정의와 노드별 집계 캐시
+ * @details 집계 하나는 (identity, combine, lift) 로 정의되는 monoid 이다.
+ *          노드 값 = lift(노드, combine(자식 값들...)) 로 아래에서 위로 계산되며,
+ *          composite 는 집계별 결과를 캐시하고 변경 시 dirty 비트를 조상 방향으로 전파한다.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace metaloki::origami {
+
+    template<typename T>
+    class leaf;
+
+    /**
+     * @brief 사용자 정의 집계 개념
+     * @details combine 은 결합 법칙을 만족하고 identity 는 그 항등원이어야 한다.
+     *          lift(node, children) 은 자식 결합값에 노드 자신을 반영한다 (자식이 없으면 children == identity).
+     */
+    template<typename A>
+    concept Aggregate = requires(const typename A::value_type& value) {
+        typename A::value_type;
+        { A::identity() } -> std::convertible_to<typename A::value_type>;
+        { A::combine(value, value) } -> std::convertible_to<typename A::value_type>;
+    };
+
+    namespace aggregates {
+
+        // 루트를 포함한 전체 노드 수
+        struct count {
+            using value_type = std::size_t;
+
+            static constexpr value_type identity() { return 0; }
+            static constexpr value_type combine(value_type a, value_type b) { return a + b; }
+
+            template<typename Node>
+            static constexpr value_type lift(const Node&, value_type children) { return children + 1; }
+        };
+
+        // Element 타입 노드 수
+        template<typename Element>
+        struct count_of {
+            using value_type = std::size_t;
+
+            static constexpr value_type identity() { return 0; }
+            static constexpr value_type combine(value_type a, value_type b) { return a + b; }
+
+            template<typename Node>
+            static constexpr value_type lift(const Node&, value_type children) {
+                return children + (std::is_same_v<Node, Element> ? 1 : 0);
+            }
+        };
+
+        // leaf<T> 값의 합
+        template<typename T>
+        struct sum {
+            using value_type = T;
+
+            static value_type identity() { return T{}; }
+            static value_type combine(const value_type& a, const value_type& b) { return a + b; }
+
+            template<typename Node>
+            static value_type lift(const Node& node, value_type children) {
+                if constexpr (std::is_same_v<Node, leaf<T>>) {
+                    return children + node.value();
+                } else {
+                    return children;
+                }
+            }
+        };
+
+        // 노드 자신을 1 로 센 최대 깊이 (단말 노드 = 1)
+        struct max_depth {
+            using value_type = std::size_t;
+
+            static constexpr value_type identity() { return 0; }
+            static constexpr value_type combine(value_type a, value_type b) { return std::max(a, b); }
+
+            template<typename Node>
+            static constexpr value_type lift(const Node&, value_type children) { return children + 1; }
+        };
+
+        template<typename T>
+        struct value_range {
+            T min;
+            T max;
+
+            bool operator==(const value_range&) const = default;
+        };
+
+        // leaf<T> 값의 최솟값/최댓값 (해당 leaf 가 없으면 nullopt)
+        template<typename T>
+        struct min_max {
+            using value_type = std::optional<value_range<T>>;
+
+            static value_type identity() { return std::nullopt; }
+
+            static value_type combine(const value_type& a, const value_type& b) {
+                if (!a) return b;
+                if (!b) return a;
+                return value_range<T>{std::min(a->min, b->min), std::max(a->max, b->max)};
+            }
+
+            template<typename Node>
+            static value_type lift(const Node& node, value_type children) {
+                if constexpr (std::is_same_v<Node, leaf<T>>) {
+                    return combine(children, value_range<T>{node.value(), node.value()});
+                } else {
+                    return children;
+                }
+            }
+        };
+    }
+
+    namespace detail {
+
+        /**
+         * @brief composite 하나가 소유하는 집계 결과 캐시
+         * @details 불변식: dirty 인 노드의 조상은 모두 dirty 이다.
+         *          따라서 무효화는 이미 dirty 인 조상을 만나면 멈추고, 연속 변경은 상수 시간이다.
+         *          parent 링크는 자신을 담은 composite 의 캐시를 가리키며, 이동/복사 시 끊기고
+         *          부모가 자식을 다시 연결한다 (이동/복사, add, 집계 계산 시).
+         */
+        class aggregate_cache {
+        private:
+            struct slot_base {
+                const void* key = nullptr;
+                bool valid = false;
+
+                virtual ~slot_base() = default;
+            };
+
+            template<typename A>
+            struct slot : slot_base {
+                std::optional<typename A::value_type> value;
+            };
+
+            // 집계 타입마다 고유 주소 하나
+            template<typename A>
+            static constexpr char key_of = 0;
+
+            std::vector<std::unique_ptr<slot_base>> slots_;
+            aggregate_cache* parent_ = nullptr;
+            bool dirty_ = true;
+
+        public:
+            aggregate_cache() = default;
+
+            // 복사본은 빈 캐시로 시작하고 아직 어느 부모에도 연결되지 않는다
+            aggregate_cache(const aggregate_cache&) noexcept {}
+            aggregate_cache& operator=(const aggregate_cache&) noexcept {
+                invalidate();
+                return *this;
+            }
+
+            // 이동은 결과를 유지하되 부모 링크는 끊는다 (새 위치의 부모가 다시 연결)
+            aggregate_cache(aggregate_cache&& other) noexcept
+                : slots_(std::move(other.slots_)), dirty_(other.dirty_) {
+                other.dirty_ = true;
+            }
+
+            aggregate_cache& operator=(aggregate_cache&& other) noexcept {
+                slots_ = std::move(other.slots_);
+                other.dirty_ = true;
+                // 같은 자리의 내용이 바뀌었으므로 조상에 알린다
+                invalidate();
+                return *this;
+            }
+
+            void link_to(aggregate_cache* parent) noexcept { parent_ = parent; }
+
+            bool dirty() const noexcept { return dirty_; }
+
+            // 자신과 dirty 가 아닌 조상들을 dirty 로 표시
+            void invalidate() noexcept {
+                for (auto* node = this; node && !node->dirty_; node = node->parent_) {
+                    node->dirty_ = true;
+                    for (auto& entry : node->slots_) {
+                        entry->valid = false;
+                    }
+                }
+            }
+
+            // A 는 집계 또는 value_type 을 가진 캐시 키 (예: leaf 열 색인)
+            template<typename A>
+            const typename A::value_type* find() const noexcept {
+                if (dirty_) return nullptr;
+                for (const auto& entry : slots_) {
+                    if (entry->key == &key_of<A> && entry->valid) {
+                        return &*static_cast<const slot<A>&>(*entry).value;
+                    }
+                }
+                return nullptr;
+            }
+
+            template<typename A>
+            const typename A::value_type& store(typename A::value_type value) {
+                if (dirty_) {
+                    for (auto& entry : slots_) {
+                        entry->valid = false;
+                    }
+                    dirty_ = false;
+                }
+
+                slot<A>* target = nullptr;
+                for (auto& entry : slots_) {
+                    if (entry->key == &key_of<A>) {
+                        target = static_cast<slot<A>*>(entry.get());
+                        break;
+                    }
+                }
+                if (!target) {
+                    auto created = std::make_unique<slot<A>>();
+                    created->key = &key_of<A>;
+                    target = created.get();
+                    slots_.push_back(std::move(created));
+                }
+
+                target->value = std::move(value);
+                target->valid = true;
+                return *target->value;
+            }
+        };
+    }
+}
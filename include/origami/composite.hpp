@@ -8,10 +8,22 @@
 
 #include <core/typelist.hpp>
 #include <core/policy_host.hpp>
+#include <origami/small_buffer.hpp>
+#include <origami/aggregates.hpp>
+#include <origami/leaf_columns.hpp>
+#include <origami/name_table.hpp>
 #include <memory>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <algorithm>
 #include <concepts>
+#include <cstdint>
+#include <utility>
+#include <variant>
 
 namespace metaloki::origami {
     
@@ -25,6 +37,199 @@ namespace metaloki::origami {
         { t.clone() } -> std::convertible_to<std::unique_ptr<T>>;
     };
     
+    namespace detail {
+        /**
+         * @brief 노드의 자식 리스트가 Element 의 연속 배열인지 확인
+         * @details 트리 순회기들은 동일 타입으로 재귀하는 자식 리스트만 하강한다
+         */
+        template<typename Node, typename Element>
+        concept has_children_of = requires(const Node& node) {
+            { node.children().data() } -> std::convertible_to<const Element*>;
+            { node.children().size() } -> std::convertible_to<std::size_t>;
+        };
+    }
+    
+    template<std::size_t InlineChildren, Component... ChildTypes>
+    class basic_composite;
+    
+    namespace detail {
+        // 파생 타입(iterable_composite 등)에서 basic_composite<N, Cs...> 기반 타입 추출
+        template<std::size_t InlineChildren, Component... ChildTypes>
+        const basic_composite<InlineChildren, ChildTypes...>* as_composite_base(
+            const basic_composite<InlineChildren, ChildTypes...>*);
+        
+        template<typename Tree>
+        using composite_base_t = std::remove_cvref_t<
+            std::remove_pointer_t<decltype(as_composite_base(std::declval<const Tree*>()))>>;
+        
+        template<typename Tree>
+        concept composite_tree = requires { typename composite_base_t<Tree>; };
+        
+        // 인라인 자식 저장소 기본 용량 - 단말 노드에 가까운 composite 만 최대 4개까지,
+        // 저장소가 이 크기를 넘지 않는 범위에서. 중첩 composite 를 담는 노드는 노드 자체가 커지므로 힙만 사용
+        inline constexpr std::size_t inline_children_budget = 128;
+        
+        template<typename... ChildTypes>
+        inline constexpr std::size_t default_inline_children =
+            (composite_tree<ChildTypes> || ...)
+                ? 0
+                : std::min<std::size_t>(4, inline_children_budget / sizeof(std::variant<ChildTypes...>));
+    }
+    
+    namespace detail {
+        // 이름으로 찾을 수 있는 자식 - composite 는 인터닝된 id, name() 을 가진 타입은 그 이름
+        template<typename Element>
+        std::optional<name_id> child_name(const Element& element) {
+            if constexpr (composite_tree<Element>) {
+                return static_cast<const composite_base_t<Element>&>(element).interned_name();
+            } else if constexpr (requires { { element.name() } -> std::convertible_to<std::string_view>; }) {
+                return intern_name(element.name());
+            } else {
+                return std::nullopt;
+            }
+        }
+        
+        /**
+         * @brief 자식 이름 -> 자식 위치 해시 색인
+         * @details 이름마다 첫 위치를 해시로 찾고, 같은 이름의 다음 위치는 next 체인으로 잇는다.
+         *          복사본은 비어 있고 (필요할 때 다시 만든다), 무효화해도 메모리는 재사용한다.
+         */
+        class child_name_index {
+        private:
+            static constexpr std::uint32_t npos = UINT32_MAX;
+            
+            struct table {
+                std::unordered_map<std::uint32_t, std::uint32_t> first;
+                std::vector<std::uint32_t> next;
+            };
+            
+            std::unique_ptr<table> table_;
+            bool valid_ = false;
+            
+        public:
+            child_name_index() = default;
+            child_name_index(const child_name_index&) noexcept {}
+            child_name_index& operator=(const child_name_index&) noexcept {
+                valid_ = false;
+                return *this;
+            }
+            child_name_index(child_name_index&&) noexcept = default;
+            child_name_index& operator=(child_name_index&&) noexcept = default;
+            
+            bool valid() const noexcept { return valid_; }
+            void invalidate() noexcept { valid_ = false; }
+            
+            template<typename Variant, std::size_t N>
+            void build(const small_vector<Variant, N>& children) {
+                if (!table_) table_ = std::make_unique<table>();
+                auto& index = *table_;
+                index.first.clear();
+                index.next.assign(children.size(), npos);
+                
+                // 뒤에서부터 채우면 각 이름의 현재 first 가 곧 다음 위치
+                for (auto i = static_cast<std::uint32_t>(children.size()); i-- > 0;) {
+                    const auto name = std::visit([](const auto& element) { return child_name(element); }, children[i]);
+                    if (!name) continue;
+                    
+                    auto [position, inserted] = index.first.try_emplace(name->value(), i);
+                    if (!inserted) {
+                        index.next[i] = position->second;
+                        position->second = i;
+                    }
+                }
+                valid_ = true;
+            }
+            
+            // 이름이 같은 자식 위치를 순서대로 op(index) 에 전달, op 가 false 를 반환하면 중단
+            template<typename Op>
+            bool for_each(name_id name, Op&& op) const {
+                const auto found = table_->first.find(name.value());
+                if (found == table_->first.end()) return true;
+                for (std::uint32_t i = found->second; i != npos; i = table_->next[i]) {
+                    if (!op(std::size_t{i})) return false;
+                }
+                return true;
+            }
+        };
+    }
+    
+    /**
+     * @brief 기본 인라인 용량의 composite
+     * @details 인라인 용량을 직접 정하려면 basic_composite<N, ChildTypes...> 를 사용한다
+     */
+    template<Component... ChildTypes>
+    using composite = basic_composite<detail::default_inline_children<ChildTypes...>, ChildTypes...>;
+    
+    namespace detail {
+        /**
+         * @brief 노드 하나의 서브트리 집계값을 후위 순서로 계산
+         * @details 동일 variant 로 재귀하는 자식은 명시적 스택으로 하강하고,
+         *          중첩 composite 는 on_composite 로 넘겨 그 노드의 캐시를 재사용한다.
+         */
+        template<Aggregate A, typename Variant, typename OnComposite>
+        typename A::value_type fold_aggregate(const Variant& root, OnComposite&& on_composite) {
+            using value_type = typename A::value_type;
+            using range = std::pair<const Variant*, const Variant*>;
+            
+            auto children_of = [](const Variant& node) -> range {
+                return std::visit([](const auto& element) -> range {
+                    if constexpr (has_children_of<std::decay_t<decltype(element)>, Variant>) {
+                        const auto& children = element.children();
+                        return {children.data(), children.data() + children.size()};
+                    } else {
+                        return {nullptr, nullptr};
+                    }
+                }, node);
+            };
+            
+            // 하강하지 않는 노드의 값
+            auto flat_value = [&on_composite](const Variant& node) -> value_type {
+                return std::visit([&on_composite](const auto& element) -> value_type {
+                    if constexpr (composite_tree<std::decay_t<decltype(element)>>) {
+                        return on_composite(element);
+                    } else {
+                        return A::lift(element, A::identity());
+                    }
+                }, node);
+            };
+            
+            const auto [first, last] = children_of(root);
+            if (first == last) return flat_value(root);
+            
+            struct frame {
+                const Variant* node;
+                const Variant* next;
+                const Variant* end;
+                value_type children;
+            };
+            
+            std::vector<frame> stack;
+            stack.push_back({&root, first, last, A::identity()});
+            
+            while (true) {
+                auto& top = stack.back();
+                if (top.next != top.end) {
+                    const Variant& child = *top.next++;
+                    const auto [child_first, child_last] = children_of(child);
+                    if (child_first == child_last) {
+                        top.children = A::combine(std::move(top.children), flat_value(child));
+                    } else {
+                        stack.push_back({&child, child_first, child_last, A::identity()});
+                    }
+                    continue;
+                }
+                
+                value_type value = std::visit([&top](const auto& element) -> value_type {
+                    return A::lift(element, std::move(top.children));
+                }, *top.node);
+                stack.pop_back();
+                
+                if (stack.empty()) return value;
+                stack.back().children = A::combine(std::move(stack.back().children), std::move(value));
+            }
+        }
+    }
+    
     /**
      * @brief 검색 결과 [5] "Base component" 구현
      * @details Component 인터페이스 템플릿
@@ -78,22 +283,304 @@ namespace metaloki::origami {
         }
     };
     
+    namespace detail {
+        // aggregate_cache 안에서 leaf<T> 열 색인을 찾는 키
+        template<typename T>
+        struct leaf_column_key {
+            using value_type = leaf_column<T>;
+        };
+        
+        /**
+         * @brief element 와 그 아래 노드에 전위 순서 id 를 매기며 leaf<T> 값을 column 에 추가
+         * @details 중첩 composite 타입 깊이만큼만 재귀한다 (composite 는 자기 자신을 담을 수 없음)
+         */
+        template<typename T, typename Element>
+        void collect_leaf_column(const Element& element, std::uint32_t& next_id, leaf_column<T>& column) {
+            const std::uint32_t id = next_id++;
+            if constexpr (std::is_same_v<Element, leaf<T>>) {
+                column.push_back(element.value(), id);
+            } else if constexpr (composite_tree<Element>) {
+                for (const auto& child : static_cast<const composite_base_t<Element>&>(element).children()) {
+                    std::visit([&next_id, &column](const auto& nested) {
+                        collect_leaf_column<T>(nested, next_id, column);
+                    }, child);
+                }
+            }
+        }
+    }
+    
+    /**
+     * @brief walk 콜백이 순회를 제어하는 값
+     * @details proceed - 자식으로 내려감, skip_subtree - 이 노드의 자식을 건너뜀 (post 는 호출됨),
+     *          stop - 즉시 끝냄 (이후 콜백 없음)
+     */
+    enum class traverse_action : unsigned char {
+        proceed,
+        skip_subtree,
+        stop
+    };
+    
+    namespace detail {
+        // children() 가 연속 variant 배열인 노드 - composite 와 같은 variant 로 재귀하는 섹션 등
+        template<typename Node>
+        concept walkable_node = requires(const Node& node) {
+            node.children().data();
+            { node.children().size() } -> std::convertible_to<std::size_t>;
+        };
+        
+        // 콜백에 넘길 노드 타입 - composite 는 기반 타입으로
+        template<typename Element>
+        struct walk_node {
+            using type = Element;
+        };
+        
+        template<composite_tree Element>
+        struct walk_node<Element> {
+            using type = composite_base_t<Element>;
+        };
+        
+        // 자식 variant 에 내려갈 수 있는 대안이 있는지
+        template<typename Variant>
+        struct has_walkable_alternative : std::true_type {};
+        
+        template<typename... Alternatives>
+        struct has_walkable_alternative<std::variant<Alternatives...>>
+            : std::bool_constant<(walkable_node<typename walk_node<Alternatives>::type> || ...)> {};
+        
+        /**
+         * @brief 재귀 없는 전위/후위 순회 엔진
+         * @details 스택 프레임은 (노드, 다음 자식 위치) 와 노드 타입별 재개 함수 하나다.
+         *          자식 루프는 노드 타입마다 인스턴스화되어 직접 호출되고, 간접 호출은
+         *          하위 노드에 들어가거나 돌아올 때만 생긴다. 깊이는 힙 스택이 감당한다.
+         *          composite 자식은 composite 기반 타입으로 콜백에 전달된다.
+         */
+        template<typename Pre, typename Post>
+        class tree_walker {
+        private:
+            struct frame {
+                const void* node;
+                std::size_t next;
+                void (*resume)(tree_walker&);
+            };
+            
+            Pre& pre_;
+            Post& post_;
+            inline_stack<frame, 32> stack_;
+            bool stopped_ = false;
+            
+            // 콜백이 Node 에 대해 순회를 제어하는지 (traverse_action 반환)
+            template<typename Callback, typename Node>
+            static constexpr bool controls = std::is_same_v<std::invoke_result_t<Callback&, const Node&>, traverse_action>;
+            
+            template<typename Callback, typename Node>
+            static traverse_action invoke(Callback& callback, const Node& node) {
+                if constexpr (controls<Callback, Node>) {
+                    return callback(node);
+                } else {
+                    callback(node);
+                    return traverse_action::proceed;
+                }
+            }
+            
+            template<typename Node>
+            void leave(const Node& node) {
+                if (invoke(post_, node) == traverse_action::stop) stopped_ = true;
+            }
+            
+            template<typename Node>
+            static void resume(tree_walker& walker) {
+                frame& top = walker.stack_.top();
+                const Node& node = *static_cast<const Node*>(top.node);
+                const auto& children = node.children();
+                const std::size_t count = children.size();
+                
+                for (std::size_t i = top.next; i < count; ++i) {
+                    // 하위 프레임을 쌓으면 top 참조가 무효가 되므로 먼저 재개 위치를 기록
+                    top.next = i + 1;
+                    const bool descended = std::visit([&walker](const auto& element) {
+                        return walker.enter(element);
+                    }, children[i]);
+                    if (descended || walker.stopped_) return;
+                }
+                
+                walker.stack_.pop();
+                walker.leave(node);
+            }
+            
+        public:
+            tree_walker(Pre& pre, Post& post) : pre_(pre), post_(post) {}
+            
+            // element 에 pre 를 적용하고, 내려가야 하면 프레임을 쌓고 true
+            template<typename Element>
+            bool enter(const Element& element) {
+                using node_type = typename walk_node<Element>::type;
+                const node_type& node = element;
+                
+                const traverse_action action = invoke(pre_, node);
+                if (action == traverse_action::stop) {
+                    stopped_ = true;
+                    return false;
+                }
+                if constexpr (walkable_node<node_type>) {
+                    if (action == traverse_action::proceed && node.children().size() != 0) {
+                        using child_type = std::remove_cvref_t<decltype(node.children()[0])>;
+                        if constexpr (!has_walkable_alternative<child_type>::value) {
+                            // 자식이 모두 단말이면 프레임 없이 바로 돈다 (leaf 만 담은 행 등)
+                            for (const auto& child : node.children()) {
+                                const bool stop = std::visit([this](const auto& leaf_node) {
+                                    using leaf_type = std::decay_t<decltype(leaf_node)>;
+                                    if constexpr (controls<Pre, leaf_type> || controls<Post, leaf_type>) {
+                                        if (invoke(pre_, leaf_node) == traverse_action::stop) {
+                                            stopped_ = true;
+                                        } else {
+                                            leave(leaf_node);
+                                        }
+                                        return stopped_;
+                                    } else {
+                                        pre_(leaf_node);
+                                        post_(leaf_node);
+                                        return false;
+                                    }
+                                }, child);
+                                if (stop) return false;
+                            }
+                        } else {
+                            stack_.push({&node, 0, &tree_walker::resume<node_type>});
+                            return true;
+                        }
+                    }
+                }
+                leave(node);
+                return false;
+            }
+            
+            // 끝까지 돌면 true, stop 으로 멈추면 false
+            template<typename Root>
+            bool run(const Root& root) {
+                enter(root);
+                while (!stack_.empty() && !stopped_) {
+                    stack_.top().resume(*this);
+                }
+                return !stopped_;
+            }
+        };
+        
+        struct ignore_node {
+            template<typename Node>
+            void operator()(const Node&) const noexcept {}
+        };
+        
+        /**
+         * @brief [first, last) 구간과 그 하위 노드 전체를 전위 순회
+         * @details tree_walker 위에서 돌며 같은 variant 의 자식뿐 아니라 중첩 composite 의 서브트리
+         *          (자기 variant 타입)까지 내려간다. op 는 각 노드를 자기 타입으로 받고 (composite 는 기반 타입),
+         *          traverse_action 을 반환해 하위 트리를 건너뛸 수 있다. 끝까지 돌면 true.
+         */
+        template<typename Variant, typename Operation>
+        bool for_each_preorder(const Variant* first, const Variant* last, Operation&& op) {
+            ignore_node post;
+            tree_walker<std::remove_reference_t<Operation>, ignore_node> walker(op, post);
+            for (; first != last; ++first) {
+                if (!std::visit([&walker](const auto& element) { return walker.run(element); }, *first)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        
+        // child_subtree_offsets() 를 집계 캐시에 보관하는 키
+        struct subtree_offsets_key {
+            using value_type = std::vector<std::size_t>;
+        };
+    }
+    
     /**
      * @brief 검색 결과 [4] "Composite - Represents the composite object"
-     * @details 복합 노드 (자식을 포함하는 요소)
+     * @details 복합 노드 (자식을 포함하는 요소). 자식은 InlineChildren 개까지 노드 안에 저장되고
+     *          그 이상일 때만 힙을 사용한다.
      */
-    template<Component... ChildTypes>
-    class composite : public component_base<composite<ChildTypes...>> {
+    template<std::size_t InlineChildren, Component... ChildTypes>
+    class basic_composite : public component_base<basic_composite<InlineChildren, ChildTypes...>> {
     private:
+        template<std::size_t, Component...>
+        friend class basic_composite;
+        
         using child_variant = std::variant<ChildTypes...>;
-        using child_list = std::vector<child_variant>;
+        using child_list = small_vector<child_variant, InlineChildren>;
+        
+        static constexpr bool has_nested_composites = (detail::composite_tree<ChildTypes> || ...);
         
         child_list children_;
-        std::string name_;
+        
+        // 이름은 전역 name_table 의 id 로만 보관 (유효 플래그와 함께 한 워드에 들어감)
+        name_id name_;
+        
+        // 자식이 name_index_threshold 이상일 때 처음 이름으로 찾을 때 만드는 색인
+        mutable detail::child_name_index name_index_;
+        
+        // 집계 결과 캐시 - 중첩 composite 의 캐시는 이 캐시를 부모로 가리킨다
+        mutable detail::aggregate_cache aggregates_;
+        
+        // 구조 변경 시 호출 - 집계 dirty 비트는 조상까지 전파
+        void invalidate_subtree_cache() noexcept {
+            name_index_.invalidate();
+            aggregates_.invalidate();
+        }
+        
+        // 이 노드 아래(다른 composite 를 넘지 않는 범위)의 중첩 composite 를 이 캐시에 연결
+        void link_nested_composites() const noexcept {
+            if constexpr (has_nested_composites) {
+                detail::for_each_preorder(children_.data(), children_.data() + children_.size(),
+                    [this](const auto& node) {
+                        if constexpr (detail::composite_tree<std::decay_t<decltype(node)>>) {
+                            node.aggregates_.link_to(&aggregates_);
+                            return traverse_action::skip_subtree;
+                        } else {
+                            return traverse_action::proceed;
+                        }
+                    });
+            }
+        }
+        
+        // 중첩 composite 의 집계값 - 이 캐시에 연결해 이후 하위 변경이 여기까지 전파되게 한다
+        template<Aggregate A>
+        auto nested_aggregate() const {
+            return [this](const auto& nested) -> typename A::value_type {
+                const auto& base = static_cast<const detail::composite_base_t<std::decay_t<decltype(nested)>>&>(nested);
+                base.aggregates_.link_to(&aggregates_);
+                return base.template aggregate<A>();
+            };
+        }
         
     public:
+        static constexpr std::size_t inline_children = InlineChildren;
+        
         // 생성자
-        explicit composite(std::string name = "Composite") : name_(std::move(name)) {}
+        explicit basic_composite(std::string_view name = "Composite") : name_(intern_name(name)) {}
+        explicit basic_composite(name_id name) noexcept : name_(name) {}
+        
+        basic_composite(const basic_composite&) = default;
+        basic_composite& operator=(const basic_composite&) = default;
+        
+        // 자식 버퍼가 그대로 옮겨 오므로 중첩 composite 의 부모 링크를 새 위치로 갱신
+        basic_composite(basic_composite&& other) noexcept
+            : children_(std::move(other.children_)),
+              name_(other.name_),
+              name_index_(std::move(other.name_index_)),
+              aggregates_(std::move(other.aggregates_)) {
+            other.name_index_.invalidate();
+            link_nested_composites();
+        }
+        
+        basic_composite& operator=(basic_composite&& other) noexcept {
+            children_ = std::move(other.children_);
+            name_ = other.name_;
+            name_index_ = std::move(other.name_index_);
+            other.name_index_.invalidate();
+            aggregates_ = std::move(other.aggregates_);
+            link_nested_composites();
+            return *this;
+        }
         
         // 검색 결과 [5] "void add(Component* component)"
         template<Component ChildType>
@@ -102,6 +589,7 @@ namespace metaloki::origami {
                 "Child type must be one of the supported types");
             
             children_.push_back(std::forward<ChildType>(child));
+            invalidate_subtree_cache();
         }
         
         // 템플릿 버전 - 복사본 추가
@@ -111,6 +599,7 @@ namespace metaloki::origami {
                 "Child type must be one of the supported types");
             
             children_.push_back(child);
+            invalidate_subtree_cache();
         }
         
         // 검색 결과 [5] "std::vector<std::shared_ptr<TextComponent>> children;"
@@ -120,15 +609,214 @@ namespace metaloki::origami {
                 "Child type must be one of the supported types");
             
             children_.push_back(ChildType(std::forward<Args>(args)...));
+            invalidate_subtree_cache();
+        }
+        
+        // 자식 용량 사전 확보 - 이후 add/emplace 가 재할당 없이 들어간다
+        void reserve(std::size_t capacity) {
+            const auto* before = children_.data();
+            children_.reserve(capacity);
+            if (children_.data() != before) {
+                // 재할당으로 옮겨진 중첩 composite 는 부모 링크가 끊겼으므로 이 캐시에 다시 연결
+                link_nested_composites();
+                aggregates_.invalidate();
+            }
         }
         
-        // 자식 접근
+        /**
+         * @brief 구간의 요소를 position 앞에 삽입 - 크기를 아는 구간이면 재할당은 최대 한 번
+         * @details 요소는 자식 타입 중 하나이거나 자식 variant. 소유 컨테이너를 rvalue 로 넘기면 요소를 이동한다.
+         */
+        template<std::ranges::input_range Range>
+        void insert_range(std::size_t position, Range&& range) {
+            static_assert(std::is_constructible_v<child_variant, std::ranges::range_reference_t<Range>>,
+                "Range elements must be one of the supported child types");
+            if (position > children_.size()) {
+                throw std::out_of_range("composite::insert_range position out of range");
+            }
+            
+            const auto target = children_.begin() + position;
+            if constexpr (!std::ranges::common_range<Range>) {
+                auto common = std::forward<Range>(range) | std::views::common;
+                children_.insert(target, common.begin(), common.end());
+            } else if constexpr (!std::is_lvalue_reference_v<Range> && !std::ranges::view<std::remove_cvref_t<Range>>) {
+                children_.insert(target, std::make_move_iterator(std::ranges::begin(range)),
+                                 std::make_move_iterator(std::ranges::end(range)));
+            } else {
+                children_.insert(target, std::ranges::begin(range), std::ranges::end(range));
+            }
+            invalidate_subtree_cache();
+        }
+        
+        template<std::ranges::input_range Range>
+        void append_range(Range&& range) {
+            insert_range(children_.size(), std::forward<Range>(range));
+        }
+        
+        /**
+         * @brief source 의 자식 [first, last) 를 이동해 position 앞에 붙인다 (복사 없음)
+         * @details 이 composite 는 한 번만 재할당하고, source 에서는 해당 구간이 제거된다
+         */
+        template<std::size_t OtherInline>
+        void splice(std::size_t position, basic_composite<OtherInline, ChildTypes...>& source,
+                    std::size_t first, std::size_t last) {
+            if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+                throw std::invalid_argument("composite::splice source must be another composite");
+            }
+            if (first > last || last > source.children_.size()) {
+                throw std::out_of_range("composite::splice source range out of range");
+            }
+            if (position > children_.size()) {
+                throw std::out_of_range("composite::splice position out of range");
+            }
+            
+            auto& moved = source.children_;
+            children_.insert(children_.begin() + position,
+                             std::make_move_iterator(moved.begin() + first),
+                             std::make_move_iterator(moved.begin() + last));
+            invalidate_subtree_cache();
+            source.erase_range(first, last);
+        }
+        
+        template<std::size_t OtherInline>
+        void splice(std::size_t position, basic_composite<OtherInline, ChildTypes...>& source) {
+            splice(position, source, 0, source.children_.size());
+        }
+        
+        // 자식 [first, last) 제거 - 뒤쪽 자식을 한 번에 당긴다
+        void erase_range(std::size_t first, std::size_t last) {
+            if (first > last || last > children_.size()) {
+                throw std::out_of_range("composite::erase_range range out of range");
+            }
+            children_.erase(children_.begin() + first, children_.begin() + last);
+            invalidate_subtree_cache();
+        }
+        
+        // 자식 접근 - 가변 접근은 캐시된 서브트리 정보를 무효화
         const child_list& children() const { return children_; }
-        child_list& children() { return children_; }
+        child_list& children() {
+            invalidate_subtree_cache();
+            return children_;
+        }
+        
+        /**
+         * @brief 자식별 서브트리 크기 누적합 (offsets[i+1] - offsets[i] = i번째 자식 서브트리 노드 수)
+         * @details 중첩 composite 의 노드까지 센다. aggregate<aggregates::count>() 와 같은 캐시에 보관되므로
+         *          하위 composite 가 바뀌어도 dirty 비트를 따라 무효화되고, 깨끗한 중첩 composite 는
+         *          캐시된 개수를 그대로 쓴다. 병렬 순회가 넓은 최상위 레벨을 균형 있게 분할하는 데 사용한다.
+         */
+        const std::vector<std::size_t>& child_subtree_offsets() const {
+            using key = detail::subtree_offsets_key;
+            if (const auto* cached = aggregates_.template find<key>()) {
+                return *cached;
+            }
+            
+            const auto nested_count = nested_aggregate<aggregates::count>();
+            std::vector<std::size_t> offsets;
+            offsets.reserve(children_.size() + 1);
+            offsets.push_back(0);
+            for (const auto& child : children_) {
+                offsets.push_back(offsets.back() + detail::fold_aggregate<aggregates::count>(child, nested_count));
+            }
+            return aggregates_.template store<key>(std::move(offsets));
+        }
+        
+        // 자신을 포함한 전체 노드 수
+        std::size_t subtree_size() const {
+            return 1 + child_subtree_offsets().back();
+        }
+        
+        // 이 수 이상의 자식을 가진 노드만 이름 색인을 만든다 (그 아래는 id 비교 선형 탐색이 더 빠름)
+        static constexpr std::size_t name_index_threshold = 16;
+        
+        /**
+         * @brief 이름이 name 인 자식 위치를 앞에서부터 op(index) 에 전달
+         * @details op 가 false 를 반환하면 멈추고 false 를 반환한다. 넓은 노드는 색인으로 O(1) 에 찾는다.
+         */
+        template<typename Op>
+        bool for_each_child_named(name_id name, Op&& op) const {
+            if (children_.size() >= name_index_threshold) {
+                if (!name_index_.valid()) name_index_.build(children_);
+                return name_index_.for_each(name, op);
+            }
+            
+            for (std::size_t i = 0; i < children_.size(); ++i) {
+                const auto child = std::visit([](const auto& element) { return detail::child_name(element); }, children_[i]);
+                if (child == name && !op(i)) return false;
+            }
+            return true;
+        }
+        
+        // 이름이 name 인 첫 자식 - 없으면 nullptr
+        const child_variant* find_child(name_id name) const {
+            const child_variant* found = nullptr;
+            for_each_child_named(name, [&](std::size_t index) {
+                found = &children_[index];
+                return false;
+            });
+            return found;
+        }
+        
+        const child_variant* find_child(std::string_view name) const {
+            return find_child(intern_name(name));
+        }
+        
+        /**
+         * @brief 자신을 포함한 서브트리의 집계값 (aggregates::sum, count, max_depth, min_max 또는 사용자 정의)
+         * @details 결과는 집계별로 캐시되어 반복 조회는 O(1) 이다. add/emplace/가변 children() 은
+         *          이 노드와 조상들을 dirty 로 표시하며, 다시 조회할 때 변경 경로의 노드만 재계산되고
+         *          깨끗한 중첩 composite 는 캐시된 값을 그대로 쓴다.
+         *          가변 children() 은 호출 시점에 무효화하므로 그 참조를 조회 이후까지 들고 변경하면 안 된다.
+         *          const 조회가 캐시를 갱신하므로 여러 스레드에서 동시에 조회하려면 외부 동기화가 필요하다.
+         */
+        template<Aggregate A>
+        const typename A::value_type& aggregate() const {
+            if (const auto* cached = aggregates_.template find<A>()) {
+                return *cached;
+            }
+            
+            const auto nested_value = nested_aggregate<A>();
+            
+            typename A::value_type combined = A::identity();
+            for (const auto& child : children_) {
+                combined = A::combine(std::move(combined), detail::fold_aggregate<A>(child, nested_value));
+            }
+            return aggregates_.template store<A>(A::lift(*this, std::move(combined)));
+        }
+        
+        /**
+         * @brief 서브트리의 leaf<T> 값 열 (값과 전위 순서 노드 id, 이 노드 = 0)
+         * @details 집계와 같은 캐시에 보관되므로 어디서든 구조가 바뀌면 변경 경로를 따라 무효화되고,
+         *          다음 조회 때 한 번의 순회로 다시 만든다 - 삽입을 몰아서 한 뒤 여러 번 질의하는 용도.
+         *          aggregate() 와 같은 스레드 안전성 제약을 따른다.
+         */
+        template<typename T>
+        const leaf_column<T>& column() const {
+            using key = detail::leaf_column_key<T>;
+            if (const auto* cached = aggregates_.template find<key>()) {
+                return *cached;
+            }
+            
+            // 중첩 composite 를 모두 연결하고 깨끗하게 만들어 이후 하위 변경이 여기까지 전파되게 한다
+            const std::size_t nodes = aggregate<aggregates::count>();
+            if (nodes > UINT32_MAX) {
+                throw std::length_error("composite::column supports at most 2^32 nodes");
+            }
+            
+            leaf_column<T> built;
+            if (const auto* known = aggregates_.template find<aggregates::count_of<leaf<T>>>()) built.reserve(*known);
+            std::uint32_t next_id = 1;
+            for (const auto& child : children_) {
+                std::visit([&next_id, &built](const auto& element) {
+                    detail::collect_leaf_column<T>(element, next_id, built);
+                }, child);
+            }
+            return aggregates_.template store<key>(std::move(built));
+        }
         
         // 검색 결과 [5] "void print() const override"
         void render_impl() const {
-            std::cout << "Composite '" << name_ << "' {\n";
+            std::cout << "Composite '" << name() << "' {\n";
             
             // 검색 결과 [6] std::visit 활용
             for (const auto& child : children_) {
@@ -142,32 +830,33 @@ namespace metaloki::origami {
         }
         
         // 복제 구현
-        std::unique_ptr<composite<ChildTypes...>> clone_impl() const {
-            auto clone = std::make_unique<composite<ChildTypes...>>(name_);
+        std::unique_ptr<basic_composite> clone_impl() const {
+            auto clone = std::make_unique<basic_composite>(name_);
             clone->children_ = children_;  // 복사 가능한 std::variant 사용
             return clone;
         }
         
-        // 재귀적 작업 수행 (검색 결과 [2] "recursive structure")
+        /**
+         * @brief 자신과 모든 하위 노드를 전위로 방문하며 pre, 자식을 다 돈 뒤 post 호출
+         * @details 콜백은 traverse_action 을 반환해 하위 트리를 건너뛰거나 멈출 수 있다 (void 면 proceed).
+         *          명시적 스택으로 돌기 때문에 100k 단계 깊이의 섹션 체인도 호출 스택을 쓰지 않는다.
+         *          끝까지 돌면 true, stop 으로 멈추면 false.
+         */
+        template<typename Pre, typename Post = detail::ignore_node>
+        bool walk(Pre&& pre, Post&& post = {}) const {
+            return detail::tree_walker<std::remove_reference_t<Pre>, std::remove_reference_t<Post>>(pre, post).run(*this);
+        }
+        
+        // 재귀적 작업 수행 (검색 결과 [2] "recursive structure") - 전위 순서로 모든 노드에 op
         template<typename Operation>
         void traverse(Operation&& op) const {
-            // 자신에게 작업 적용
-            op(*this);
-            
-            // 모든 자식에게 작업 적용
-            for (const auto& child : children_) {
-                std::visit([&op](const auto& c) {
-                    if constexpr (requires { c.traverse(op); }) {
-                        c.traverse(op);
-                    } else {
-                        op(c);
-                    }
-                }, child);
-            }
+            walk(op);
         }
         
-        // 이름 설정/조회
-        void set_name(std::string name) { name_ = std::move(name); }
-        const std::string& name() const { return name_; }
+        // 이름 설정/조회 - 문자열은 조회할 때 name_table 에서 찾는다
+        void set_name(std::string_view name) { name_ = intern_name(name); }
+        void set_name(name_id name) noexcept { name_ = name; }
+        std::string_view name() const noexcept { return resolve_name(name_); }
+        name_id interned_name() const noexcept { return name_; }
     };
 }
@@ -0,0 +1,181 @@
+/**
+ * @file include/origami/cow_array.hpp
+ * @brief 청크 단위 copy-on-write 배열과 그 불변 스냅샷
+ * @details 원소를 약 4KB 청크로 나눠 참조 카운트로 공유한다.
+ *          freeze() 는 청크 포인터 표만 복사한 불변 버전을 만들고, 이후 쓰기는
+ *          스냅샷과 공유 중인 청크만 복사한다. 스냅샷 읽기에는 락이 없다.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace metaloki::origami::detail {
+
+    template<typename T, std::size_t ChunkBytes>
+    class frozen_chunked_array;
+
+    /**
+     * @brief 쓰기 쪽 청크 배열
+     * @details 쓰기는 한 스레드(또는 소유 객체의 ThreadingPolicy 락 아래)에서만 일어나야 한다.
+     *          청크가 단독 소유(use_count == 1)일 때만 제자리에서 수정하며, 그 값은
+     *          다른 스레드가 참조를 놓는 경우에만 줄어들므로 acquire 펜스로 해당 읽기가 끝났음을 보장한다.
+     */
+    template<typename T, std::size_t ChunkBytes = 4096>
+    class cow_chunked_array {
+    public:
+        // 청크당 원소 수 (2의 거듭제곱 - 인덱스 계산을 시프트/마스크로)
+        static constexpr std::size_t chunk_capacity =
+            std::bit_floor(std::max<std::size_t>(1, ChunkBytes / sizeof(T)));
+        static constexpr std::size_t chunk_shift = std::countr_zero(chunk_capacity);
+        static constexpr std::size_t chunk_mask = chunk_capacity - 1;
+
+        using chunk = std::vector<T>;
+        using frozen = frozen_chunked_array<T, ChunkBytes>;
+
+    private:
+        std::vector<std::shared_ptr<chunk>> chunks_;
+        std::size_t size_ = 0;
+
+        static std::shared_ptr<chunk> make_chunk() {
+            auto created = std::make_shared<chunk>();
+            created->reserve(chunk_capacity);
+            return created;
+        }
+
+        // 공유 중이면 복사해 단독 소유로 만든다
+        chunk& writable_chunk(std::size_t index) {
+            auto& owned = chunks_[index];
+            if (owned.use_count() != 1) {
+                auto copy = make_chunk();
+                copy->assign(owned->begin(), owned->end());
+                owned = std::move(copy);
+            } else {
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            return *owned;
+        }
+
+    public:
+        cow_chunked_array() = default;
+
+        // 복사는 청크를 공유 - 이후 양쪽 모두 쓰기 시 복사
+        cow_chunked_array(const cow_chunked_array&) = default;
+        cow_chunked_array& operator=(const cow_chunked_array&) = default;
+
+        cow_chunked_array(cow_chunked_array&& other) noexcept
+            : chunks_(std::move(other.chunks_)), size_(std::exchange(other.size_, 0)) {}
+
+        cow_chunked_array& operator=(cow_chunked_array&& other) noexcept {
+            chunks_ = std::move(other.chunks_);
+            size_ = std::exchange(other.size_, 0);
+            return *this;
+        }
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        // 읽기 - 복사 없음
+        const T& operator[](std::size_t index) const {
+            return (*chunks_[index >> chunk_shift])[index & chunk_mask];
+        }
+
+        // 쓰기 - 해당 청크만 필요 시 복사
+        T& mutable_at(std::size_t index) {
+            return writable_chunk(index >> chunk_shift)[index & chunk_mask];
+        }
+
+        template<typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (size_ % chunk_capacity == 0) {
+                chunks_.push_back(make_chunk());
+            }
+            auto& target = writable_chunk(chunks_.size() - 1);
+            T& created = target.emplace_back(std::forward<Args>(args)...);
+            ++size_;
+            return created;
+        }
+
+        void reserve(std::size_t count) {
+            chunks_.reserve((count + chunk_capacity - 1) / chunk_capacity);
+        }
+
+        // 앞쪽 count 개만 남긴다 - 잘리는 청크만 필요 시 복사
+        void truncate(std::size_t count) {
+            if (count >= size_) return;
+            chunks_.resize((count + chunk_capacity - 1) / chunk_capacity);
+            if (count % chunk_capacity != 0) {
+                auto& last = writable_chunk(chunks_.size() - 1);
+                // pop_back 만 쓴다 - erase 와 달리 T 의 이동 대입을 요구하지 않는다
+                while (last.size() > count % chunk_capacity) last.pop_back();
+            }
+            size_ = count;
+        }
+
+        void clear() noexcept {
+            chunks_.clear();
+            size_ = 0;
+        }
+
+        // 청크 순서대로 연속 구간을 전달 (op(const T* first, const T* last, std::size_t first_index))
+        template<typename Operation>
+        void for_each_chunk(Operation&& op) const {
+            std::size_t base = 0;
+            for (const auto& owned : chunks_) {
+                op(owned->data(), owned->data() + owned->size(), base);
+                base += owned->size();
+            }
+        }
+
+        // 현재 내용을 불변 버전으로 고정 - 청크 포인터 표만 복사
+        frozen freeze() const {
+            auto table = std::make_shared<std::vector<std::shared_ptr<const chunk>>>(chunks_.begin(), chunks_.end());
+            return frozen(std::move(table), size_);
+        }
+    };
+
+    /**
+     * @brief freeze() 결과 - 읽기 전용이며 여러 스레드에서 락 없이 동시에 사용할 수 있다
+     */
+    template<typename T, std::size_t ChunkBytes = 4096>
+    class frozen_chunked_array {
+    private:
+        using writer = cow_chunked_array<T, ChunkBytes>;
+        using chunk = typename writer::chunk;
+        using table = std::vector<std::shared_ptr<const chunk>>;
+
+        friend writer;
+
+        std::shared_ptr<const table> table_;
+        std::size_t size_ = 0;
+
+        frozen_chunked_array(std::shared_ptr<const table> chunks, std::size_t size)
+            : table_(std::move(chunks)), size_(size) {}
+
+    public:
+        frozen_chunked_array() = default;
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        const T& operator[](std::size_t index) const {
+            return (*(*table_)[index >> writer::chunk_shift])[index & writer::chunk_mask];
+        }
+
+        template<typename Operation>
+        void for_each_chunk(Operation&& op) const {
+            if (!table_) return;
+            std::size_t base = 0;
+            for (const auto& owned : *table_) {
+                op(owned->data(), owned->data() + owned->size(), base);
+                base += owned->size();
+            }
+        }
+    };
+}
@@ -0,0 +1,134 @@
+/**
+ * @file include/origami/edge_attributes.hpp
+ * @brief 접힘선(간선) 속성 열 저장소 - 접힘선 번호 순서의 SoA
+ * @details 산/골 구분, 접힘 각, 강성 같은 간선 데이터를 속성마다 연속 배열 하나로 둔다.
+ *          행 번호는 접힘선이 작은 쪽 끝에서 처음 나온 순서의 번호로, crease_graph::visit_connections 와
+ *          origami_composite::visit_connection_ids 가 넘기는 id 로 바로 찾는다. 양방향 접힘선도 한 행이라
+ *          시뮬레이션 커널은 필요한 열만 순서대로 한 번씩 훑는다 (자동 벡터화 가능).
+ */
+
+#pragma once
+
+#include <origami/graph_algorithms.hpp>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace metaloki::origami::graph {
+
+    namespace detail {
+        template<typename T, typename... Ts>
+        inline constexpr std::size_t attribute_count = (std::size_t{std::is_same_v<T, Ts>} + ... + 0);
+
+        template<typename T, typename... Ts>
+        inline constexpr std::size_t attribute_index = [] {
+            constexpr bool matches[] = {std::is_same_v<T, Ts>...};
+            std::size_t index = 0;
+            while (!matches[index]) ++index;
+            return index;
+        }();
+    }
+
+    /**
+     * @brief 간선 속성 열 - 열마다 std::vector<Column>, 모든 열의 길이는 접힘선 수
+     * @details 같은 타입 열이 여럿이면(각도와 강성이 모두 double 등) 위치 column<I>() 로,
+     *          타입이 유일하면 column<T>() 로도 접근한다
+     */
+    template<typename... Columns>
+    class edge_attributes {
+        static_assert(sizeof...(Columns) > 0, "edge_attributes needs at least one column");
+        static_assert((!std::is_same_v<Columns, bool> && ...), "bool columns are bit-packed; use std::uint8_t");
+
+    private:
+        std::tuple<std::vector<Columns>...> columns_;
+        std::size_t size_ = 0;
+
+    public:
+        template<std::size_t I>
+        using column_type = std::tuple_element_t<I, std::tuple<Columns...>>;
+
+        edge_attributes() = default;
+
+        // 접힘선 edge_count 개 - 모든 속성은 값 초기화
+        explicit edge_attributes(std::size_t edge_count) { resize(edge_count); }
+
+        explicit edge_attributes(const crease_graph& graph) : edge_attributes(graph.crease_count()) {}
+
+        /**
+         * @brief graph 의 접힘선마다 make(from, to, edge_id) -> std::tuple<Columns...> 로 채운다
+         * @details make 는 접힘선마다 한 번, 처음 방문한 쪽 끝(소유자)을 from 으로 불린다
+         */
+        template<typename Function>
+        static edge_attributes from(const crease_graph& graph, Function&& make) {
+            edge_attributes attributes(graph.crease_count());
+            std::vector<bool> filled(graph.crease_count(), false);
+            for (vertex v = 0; v < graph.node_count(); ++v) {
+                graph.visit_connections(v, [&](vertex from, vertex to, std::size_t edge) {
+                    if (filled[edge]) return;
+                    filled[edge] = true;
+                    attributes.assign_row(edge, make(from, to, edge), std::index_sequence_for<Columns...>{});
+                });
+            }
+            return attributes;
+        }
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        void resize(std::size_t edge_count) {
+            std::apply([edge_count](auto&... column) { (column.resize(edge_count), ...); }, columns_);
+            size_ = edge_count;
+        }
+
+        template<std::size_t I>
+        std::span<column_type<I>> column() noexcept { return std::get<I>(columns_); }
+
+        template<std::size_t I>
+        std::span<const column_type<I>> column() const noexcept { return std::get<I>(columns_); }
+
+        template<typename T>
+            requires (detail::attribute_count<T, Columns...> == 1)
+        std::span<T> column() noexcept { return std::get<detail::attribute_index<T, Columns...>>(columns_); }
+
+        template<typename T>
+            requires (detail::attribute_count<T, Columns...> == 1)
+        std::span<const T> column() const noexcept { return std::get<detail::attribute_index<T, Columns...>>(columns_); }
+
+        // 간선 하나의 I 번째 속성 (범위 검사 없음)
+        template<std::size_t I>
+        column_type<I>& at(std::size_t edge) noexcept { return std::get<I>(columns_)[edge]; }
+
+        template<std::size_t I>
+        const column_type<I>& at(std::size_t edge) const noexcept { return std::get<I>(columns_)[edge]; }
+
+        // 간선 하나의 모든 속성 참조
+        std::tuple<Columns&...> row(std::size_t edge) {
+            check(edge);
+            return std::apply([edge](auto&... column) { return std::tie(column[edge]...); }, columns_);
+        }
+
+        std::tuple<const Columns&...> row(std::size_t edge) const {
+            check(edge);
+            return std::apply([edge](const auto&... column) { return std::tie(column[edge]...); }, columns_);
+        }
+
+        void set(std::size_t edge, Columns... values) {
+            check(edge);
+            assign_row(edge, std::forward_as_tuple(std::move(values)...), std::index_sequence_for<Columns...>{});
+        }
+
+    private:
+        void check(std::size_t edge) const {
+            if (edge >= size_) throw std::out_of_range("edge_attributes: edge id out of range");
+        }
+
+        template<typename Row, std::size_t... Is>
+        void assign_row(std::size_t edge, Row&& values, std::index_sequence<Is...>) {
+            ((std::get<Is>(columns_)[edge] = std::get<Is>(std::forward<Row>(values))), ...);
+        }
+    };
+}
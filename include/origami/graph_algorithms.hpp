@@ -0,0 +1,637 @@
+/**
+ * @file include/origami/graph_algorithms.hpp
+ * @brief origami_composite 접힘선 그래프 알고리즘 - BFS/DFS, 연결 요소, 최단 경로
+ * @details 패턴의 visit_connections 를 한 번 훑어 CSR(offsets + targets) 인접 배열 crease_graph 를 만들고,
+ *          모든 알고리즘은 노드 번호 배열과 비트셋 위에서 돈다. 작업 버퍼(graph_workspace)를 넘기면
+ *          반복 실행 중 할당이 없다. 저장형/암시적 패턴, 스냅샷, 매핑된 패턴 모두 같은 방식으로 변환된다.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace metaloki::origami::graph {
+
+    // 노드 번호 - 4 바이트로 인접 배열 대역폭을 줄인다
+    using vertex = std::uint32_t;
+
+    inline constexpr vertex no_vertex = std::numeric_limits<vertex>::max();
+
+    // 도달하지 못한 노드의 BFS 깊이
+    inline constexpr std::uint32_t unreached = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief 알고리즘이 요구하는 그래프 - 노드 수와 노드별 이웃 연속 구간
+     */
+    template<typename G>
+    concept adjacency_graph = requires(const G& graph, vertex v) {
+        { graph.node_count() } -> std::convertible_to<std::size_t>;
+        { graph.neighbors(v) } -> std::convertible_to<std::span<const vertex>>;
+    };
+
+    namespace detail {
+        /**
+         * @brief CSR 위치마다 접힘선 번호 - v -> u 와 u -> v 위치를 짝지어 같은 번호를 준다
+         * @details 노드 순서대로 훑으며 작은 쪽 끝에서 처음 나온 순서로 번호를 매기고, 접힘선 수를 반환한다.
+         *          짝은 u 의 이웃만 훑어 찾으므로 노드 차수에 비례한다. 같은 쌍의 중복은 k 번째끼리 짝짓는다.
+         */
+        template<typename Target>
+        std::size_t pair_mirrors(std::span<const std::size_t> offsets, std::span<const Target> targets,
+                                 std::vector<std::size_t>& ids) {
+            ids.assign(targets.size(), 0);
+            std::vector<bool> paired(targets.size(), false);
+            std::size_t count = 0;
+            for (std::size_t v = 0; v + 1 < offsets.size(); ++v) {
+                for (std::size_t edge = offsets[v]; edge < offsets[v + 1]; ++edge) {
+                    const std::size_t u = targets[edge];
+                    if (u < v) {
+                        std::size_t mirror = offsets[u];
+                        while (mirror < offsets[u + 1] && (targets[mirror] != v || paired[mirror])) ++mirror;
+                        if (mirror < offsets[u + 1]) {
+                            paired[mirror] = paired[edge] = true;
+                            ids[edge] = ids[mirror];
+                            continue;
+                        }
+                    }
+                    ids[edge] = count++;
+                }
+            }
+            return count;
+        }
+    }
+
+    /**
+     * @brief CSR 인접 배열 - neighbors(v) = targets[offsets[v] .. offsets[v + 1])
+     * @details targets 와 나란한 crease_ids 열이 CSR 위치마다 접힘선 번호를 준다. 양방향 접힘선은
+     *          두 위치가 같은 번호를 가지므로 접힘선 속성(edge_attributes)은 접힘선마다 한 행이다.
+     *          visit_connection_ids 를 가진 패턴은 그 번호를 그대로 쓰고, 그 밖에는 detail::pair_mirrors 로
+     *          매긴다. 두 방식은 같은 번호를 주므로 살아 있는 패턴과 매핑된 파일의 속성 행이 맞는다.
+     */
+    class crease_graph {
+    private:
+        std::vector<std::size_t> offsets_;
+        std::vector<vertex> targets_;
+        std::vector<std::size_t> crease_ids_;
+        std::size_t crease_count_ = 0;
+
+    public:
+        crease_graph() : offsets_(1, 0) {}
+
+        crease_graph(std::vector<std::size_t> offsets, std::vector<vertex> targets)
+            : offsets_(std::move(offsets)), targets_(std::move(targets)) {
+            if (offsets_.empty() || offsets_.front() != 0 || offsets_.back() != targets_.size()
+                || !std::is_sorted(offsets_.begin(), offsets_.end())) {
+                throw std::invalid_argument("crease_graph: malformed offsets");
+            }
+            const std::size_t nodes = offsets_.size() - 1;
+            for (vertex target : targets_) {
+                if (target >= nodes) throw std::out_of_range("crease_graph: edge target out of range");
+            }
+            crease_count_ = detail::pair_mirrors(std::span<const std::size_t>(offsets_),
+                                                 std::span<const vertex>(targets_), crease_ids_);
+        }
+
+        /**
+         * @brief size() 와 visit_connections(i, func) 를 가진 패턴에서 인접 배열 생성
+         * @details 노드마다 한 번 visit_connections 를 부르며 연결 순서를 그대로 유지한다
+         */
+        template<typename Pattern>
+            requires requires(const Pattern& pattern) { pattern.size(); }
+        static crease_graph from(const Pattern& pattern) {
+            const std::size_t nodes = pattern.size();
+            if (nodes >= no_vertex) {
+                throw std::length_error("crease_graph supports fewer than 2^32 - 1 nodes");
+            }
+
+            crease_graph graph;
+            graph.offsets_.reserve(nodes + 1);
+            constexpr bool numbered = requires(std::size_t i) {
+                pattern.visit_connection_ids(i, [](std::size_t, std::size_t, std::size_t) {});
+            };
+            for (std::size_t i = 0; i < nodes; ++i) {
+                if constexpr (numbered) {
+                    pattern.visit_connection_ids(i, [&graph](std::size_t, std::size_t to, std::size_t crease) {
+                        graph.targets_.push_back(static_cast<vertex>(to));
+                        graph.crease_ids_.push_back(crease);
+                        graph.crease_count_ = std::max(graph.crease_count_, crease + 1);
+                    });
+                } else {
+                    pattern.visit_connections(i, [&graph](std::size_t, std::size_t to, const auto&, const auto&) {
+                        graph.targets_.push_back(static_cast<vertex>(to));
+                    });
+                }
+                graph.offsets_.push_back(graph.targets_.size());
+            }
+            if constexpr (!numbered) {
+                graph.crease_count_ = detail::pair_mirrors(std::span<const std::size_t>(graph.offsets_),
+                                                           std::span<const vertex>(graph.targets_), graph.crease_ids_);
+            }
+            return graph;
+        }
+
+        std::size_t node_count() const noexcept { return offsets_.size() - 1; }
+
+        // 방향 간선 수 - CSR 위치 수 (양방향 접힘선은 2 개)
+        std::size_t edge_count() const noexcept { return targets_.size(); }
+
+        // 접힘선 수 - crease_ids 의 서로 다른 값 수
+        std::size_t crease_count() const noexcept { return crease_count_; }
+
+        std::span<const vertex> neighbors(vertex v) const noexcept {
+            return {targets_.data() + offsets_[v], targets_.data() + offsets_[v + 1]};
+        }
+
+        std::size_t degree(vertex v) const noexcept { return offsets_[v + 1] - offsets_[v]; }
+
+        // v 의 첫 CSR 위치
+        std::size_t edge_begin(vertex v) const noexcept { return offsets_[v]; }
+
+        std::span<const std::size_t> offsets() const noexcept { return offsets_; }
+        std::span<const vertex> targets() const noexcept { return targets_; }
+
+        // CSR 위치마다 접힘선 번호 - targets 와 같은 길이
+        std::span<const std::size_t> crease_ids() const noexcept { return crease_ids_; }
+
+        // v 의 이웃마다 func(v, to, crease_id) - crease_id 로 edge_attributes 행을 바로 찾는다
+        template<typename Function>
+        void visit_connections(vertex v, Function&& func) const {
+            for (std::size_t edge = offsets_[v]; edge < offsets_[v + 1]; ++edge) func(v, targets_[edge], crease_ids_[edge]);
+        }
+
+        // from -> to 접힘선 번호 (없으면 nullopt) - from 의 이웃만 훑는다
+        std::optional<std::size_t> find_edge(vertex from, vertex to) const noexcept {
+            for (std::size_t edge = offsets_[from]; edge < offsets_[from + 1]; ++edge) {
+                if (targets_[edge] == to) return crease_ids_[edge];
+            }
+            return std::nullopt;
+        }
+    };
+
+    /**
+     * @brief 노드 방문 비트셋 - 노드당 1 비트
+     */
+    class visited_set {
+    private:
+        std::vector<std::uint64_t> words_;
+        std::size_t size_ = 0;
+
+    public:
+        visited_set() = default;
+        explicit visited_set(std::size_t size) { reset(size); }
+
+        // size 개 노드로 맞추고 모두 미방문으로 - 확보한 용량은 재사용
+        void reset(std::size_t size) {
+            size_ = size;
+            words_.assign((size + 63) / 64, 0);
+        }
+
+        std::size_t size() const noexcept { return size_; }
+
+        bool test(vertex v) const noexcept { return (words_[v >> 6] >> (v & 63)) & 1u; }
+        void set(vertex v) noexcept { words_[v >> 6] |= std::uint64_t{1} << (v & 63); }
+
+        // 이전 값을 반환하고 설정
+        bool test_and_set(vertex v) noexcept {
+            std::uint64_t& word = words_[v >> 6];
+            const std::uint64_t mask = std::uint64_t{1} << (v & 63);
+            const bool was_set = (word & mask) != 0;
+            word |= mask;
+            return was_set;
+        }
+
+        std::size_t count() const noexcept {
+            std::size_t total = 0;
+            for (std::uint64_t word : words_) total += static_cast<std::size_t>(std::popcount(word));
+            return total;
+        }
+
+        std::span<std::uint64_t> words() noexcept { return words_; }
+        std::span<const std::uint64_t> words() const noexcept { return words_; }
+    };
+
+    /**
+     * @brief 순회 작업 버퍼 - 같은 크기 그래프를 반복 순회할 때 재할당 없음
+     */
+    struct graph_workspace {
+        visited_set visited;
+        std::vector<vertex> queue;
+        std::vector<std::pair<vertex, std::uint32_t>> stack;  // (노드, 다음 이웃 위치)
+
+        void prepare(std::size_t nodes) {
+            visited.reset(nodes);
+            queue.clear();
+            stack.clear();
+        }
+    };
+
+    namespace detail {
+        // 방문 콜백이 bool 을 반환하면 false 로 멈춘다
+        template<typename Visitor, typename... Args>
+        bool keep_going(Visitor& visitor, Args... args) {
+            if constexpr (std::is_convertible_v<std::invoke_result_t<Visitor&, Args...>, bool>) {
+                return static_cast<bool>(visitor(args...));
+            } else {
+                visitor(args...);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief 너비 우선 탐색 - visitor(v, depth) 를 방문 순서대로 호출
+     * @details visitor 가 false 를 반환하면 멈춘다. 방문한 노드 수를 반환한다.
+     */
+    template<adjacency_graph Graph, typename Visitor>
+    std::size_t breadth_first_search(const Graph& graph, vertex source, Visitor&& visitor, graph_workspace& workspace) {
+        if (source >= graph.node_count()) throw std::out_of_range("breadth_first_search: source out of range");
+        workspace.prepare(graph.node_count());
+
+        auto& queue = workspace.queue;
+        auto& visited = workspace.visited;
+        queue.push_back(source);
+        visited.set(source);
+
+        std::size_t head = 0;
+        std::uint32_t depth = 0;
+        while (head < queue.size()) {
+            const std::size_t level_end = queue.size();
+            for (; head < level_end; ++head) {
+                const vertex current = queue[head];
+                if (!detail::keep_going(visitor, current, depth)) return head + 1;
+                for (vertex next : graph.neighbors(current)) {
+                    if (!visited.test_and_set(next)) queue.push_back(next);
+                }
+            }
+            ++depth;
+        }
+        return queue.size();
+    }
+
+    template<adjacency_graph Graph, typename Visitor>
+    std::size_t breadth_first_search(const Graph& graph, vertex source, Visitor&& visitor) {
+        graph_workspace workspace;
+        return breadth_first_search(graph, source, visitor, workspace);
+    }
+
+    // source 에서의 BFS 깊이 (도달 못 하면 unreached)
+    template<adjacency_graph Graph>
+    std::vector<std::uint32_t> bfs_depths(const Graph& graph, vertex source) {
+        std::vector<std::uint32_t> depths(graph.node_count(), unreached);
+        breadth_first_search(graph, source, [&depths](vertex v, std::uint32_t depth) { depths[v] = depth; });
+        return depths;
+    }
+
+    /**
+     * @brief 깊이 우선 탐색 (전위) - visitor(v) 를 처음 도달할 때 호출
+     * @details (노드, 다음 이웃 위치) 프레임의 명시적 스택을 쓰므로 깊은 경로에서도 재귀가 없다
+     */
+    template<adjacency_graph Graph, typename Visitor>
+    std::size_t depth_first_search(const Graph& graph, vertex source, Visitor&& visitor, graph_workspace& workspace) {
+        if (source >= graph.node_count()) throw std::out_of_range("depth_first_search: source out of range");
+        workspace.prepare(graph.node_count());
+
+        auto& stack = workspace.stack;
+        auto& visited = workspace.visited;
+        visited.set(source);
+        std::size_t reached = 1;
+        if (!detail::keep_going(visitor, source)) return reached;
+        stack.push_back({source, 0});
+
+        while (!stack.empty()) {
+            auto& [current, next] = stack.back();
+            const auto neighbors = graph.neighbors(current);
+            if (next == neighbors.size()) {
+                stack.pop_back();
+                continue;
+            }
+
+            const vertex child = neighbors[next++];
+            if (visited.test_and_set(child)) continue;
+            ++reached;
+            if (!detail::keep_going(visitor, child)) return reached;
+            stack.push_back({child, 0});  // current/next 참조는 여기서 무효가 될 수 있다
+        }
+        return reached;
+    }
+
+    template<adjacency_graph Graph, typename Visitor>
+    std::size_t depth_first_search(const Graph& graph, vertex source, Visitor&& visitor) {
+        graph_workspace workspace;
+        return depth_first_search(graph, source, visitor, workspace);
+    }
+
+    /**
+     * @brief 서로소 집합 - 경로 절반 압축 + 크기 기준 합치기
+     */
+    class union_find {
+    private:
+        std::vector<vertex> parent_;
+        std::vector<vertex> size_;
+        std::size_t sets_ = 0;
+
+    public:
+        explicit union_find(std::size_t count) : parent_(count), size_(count, 1), sets_(count) {
+            std::iota(parent_.begin(), parent_.end(), vertex{0});
+        }
+
+        vertex find(vertex v) noexcept {
+            while (parent_[v] != v) {
+                parent_[v] = parent_[parent_[v]];
+                v = parent_[v];
+            }
+            return v;
+        }
+
+        // 다른 집합이었으면 합치고 true
+        bool unite(vertex a, vertex b) noexcept {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (size_[a] < size_[b]) std::swap(a, b);
+            parent_[b] = a;
+            size_[a] += size_[b];
+            --sets_;
+            return true;
+        }
+
+        std::size_t set_count() const noexcept { return sets_; }
+    };
+
+    /**
+     * @brief 연결 요소 - label[v] 는 0..count-1, 노드 번호가 작은 요소부터 번호를 매긴다
+     */
+    struct component_labels {
+        std::vector<vertex> label;
+        std::size_t count = 0;
+    };
+
+    // 방향 간선도 무방향으로 보고 묶는다 (약한 연결 요소)
+    template<adjacency_graph Graph>
+    component_labels connected_components(const Graph& graph) {
+        const std::size_t nodes = graph.node_count();
+        union_find sets(nodes);
+        for (vertex v = 0; v < nodes; ++v) {
+            for (vertex u : graph.neighbors(v)) sets.unite(v, u);
+        }
+
+        component_labels result;
+        result.label.assign(nodes, no_vertex);
+        std::vector<vertex> root_label(nodes, no_vertex);
+        for (vertex v = 0; v < nodes; ++v) {
+            const vertex root = sets.find(v);
+            if (root_label[root] == no_vertex) root_label[root] = static_cast<vertex>(result.count++);
+            result.label[v] = root_label[root];
+        }
+        return result;
+    }
+
+    /**
+     * @brief 단조 우선순위 큐 (radix heap) - 부호 없는 정수 키 전용
+     * @details 꺼낸 최솟값 이상의 키만 넣을 수 있다 (Dijkstra 조건). 키마다 O(log C) 번만 이동한다.
+     */
+    template<std::unsigned_integral Key, typename Value>
+    class radix_heap {
+    private:
+        static constexpr std::size_t bucket_count = std::numeric_limits<Key>::digits + 1;
+
+        std::vector<std::pair<Key, Value>> buckets_[bucket_count];
+        Key last_ = 0;
+        std::size_t size_ = 0;
+
+        std::size_t bucket_of(Key key) const noexcept {
+            return key == last_ ? 0 : static_cast<std::size_t>(std::bit_width(static_cast<Key>(key ^ last_)));
+        }
+
+        void refill() {
+            std::size_t index = 1;
+            while (buckets_[index].empty()) ++index;
+
+            auto& source = buckets_[index];
+            Key smallest = source.front().first;
+            for (const auto& entry : source) smallest = std::min(smallest, entry.first);
+            last_ = smallest;
+            for (auto& entry : source) buckets_[bucket_of(entry.first)].push_back(std::move(entry));
+            source.clear();
+        }
+
+    public:
+        bool empty() const noexcept { return size_ == 0; }
+        std::size_t size() const noexcept { return size_; }
+
+        void push(Key key, Value value) {
+            if (key < last_) throw std::logic_error("radix_heap: key smaller than last popped key");
+            buckets_[bucket_of(key)].emplace_back(key, std::move(value));
+            ++size_;
+        }
+
+        std::pair<Key, Value> pop() {
+            if (buckets_[0].empty()) refill();
+            auto top = std::move(buckets_[0].back());
+            buckets_[0].pop_back();
+            --size_;
+            return top;
+        }
+
+        void clear() noexcept {
+            for (auto& bucket : buckets_) bucket.clear();
+            last_ = 0;
+            size_ = 0;
+        }
+    };
+
+    /**
+     * @brief 단일 출발 최단 경로 결과
+     */
+    template<typename Weight>
+    struct shortest_paths {
+        static constexpr Weight unreachable = std::numeric_limits<Weight>::has_infinity
+            ? std::numeric_limits<Weight>::infinity() : std::numeric_limits<Weight>::max();
+
+        std::vector<Weight> distance;
+        std::vector<vertex> predecessor;  // 출발점과 도달 못 한 노드는 no_vertex
+
+        bool reachable(vertex v) const noexcept { return distance[v] != unreachable; }
+
+        // 출발점부터 target 까지 노드 목록 (도달 못 하면 빈 목록)
+        std::vector<vertex> path_to(vertex target) const {
+            std::vector<vertex> path;
+            if (!reachable(target)) return path;
+            for (vertex v = target; v != no_vertex; v = predecessor[v]) path.push_back(v);
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+    };
+
+    /**
+     * @brief Dijkstra 최단 경로 - weight(from, to, crease_id) 또는 weight(from, to) 는 음이 아니어야 한다
+     * @details 부호 없는 정수 가중치는 radix heap, 그 밖은 이진 힙(지연 삭제)을 쓴다
+     */
+    template<typename Weight, typename WeightFunction>
+    shortest_paths<Weight> dijkstra(const crease_graph& graph, vertex source, WeightFunction&& weight) {
+        const std::size_t nodes = graph.node_count();
+        if (source >= nodes) throw std::out_of_range("dijkstra: source out of range");
+
+        shortest_paths<Weight> result;
+        result.distance.assign(nodes, shortest_paths<Weight>::unreachable);
+        result.predecessor.assign(nodes, no_vertex);
+        result.distance[source] = Weight{};
+
+        auto edge_weight = [&weight](vertex from, vertex to, std::size_t edge) -> Weight {
+            if constexpr (std::is_invocable_v<WeightFunction&, vertex, vertex, std::size_t>) {
+                return static_cast<Weight>(weight(from, to, edge));
+            } else {
+                return static_cast<Weight>(weight(from, to));
+            }
+        };
+
+        auto relax_all = [&](auto& heap, auto&& push) {
+            push(heap, Weight{}, source);
+            while (!heap.empty()) {
+                const auto [dist, current] = [&heap] {
+                    if constexpr (requires { heap.pop(); }) {
+                        return heap.pop();
+                    } else {
+                        std::pop_heap(heap.begin(), heap.end(), std::greater<>{});
+                        auto top = heap.back();
+                        heap.pop_back();
+                        return top;
+                    }
+                }();
+                if (dist != result.distance[current]) continue;  // 이미 더 짧은 경로로 처리됨
+
+                const auto neighbors = graph.neighbors(current);
+                const auto creases = graph.crease_ids().subspan(graph.edge_begin(current), neighbors.size());
+                for (std::size_t i = 0; i < neighbors.size(); ++i) {
+                    const vertex next = neighbors[i];
+                    const Weight candidate = dist + edge_weight(current, next, creases[i]);
+                    if (candidate < result.distance[next]) {
+                        result.distance[next] = candidate;
+                        result.predecessor[next] = current;
+                        push(heap, candidate, next);
+                    }
+                }
+            }
+        };
+
+        if constexpr (std::unsigned_integral<Weight>) {
+            radix_heap<Weight, vertex> heap;
+            relax_all(heap, [](auto& target, Weight key, vertex v) { target.push(key, v); });
+        } else {
+            std::vector<std::pair<Weight, vertex>> heap;
+            heap.reserve(nodes);
+            relax_all(heap, [](auto& target, Weight key, vertex v) {
+                target.emplace_back(key, v);
+                std::push_heap(target.begin(), target.end(), std::greater<>{});
+            });
+        }
+        return result;
+    }
+
+    /**
+     * @brief 방향 최적화 BFS 설정 (Beamer et al.)
+     * @details 프론티어 간선 수가 미방문 간선 수 / alpha 를 넘으면 bottom-up 으로,
+     *          프론티어 노드 수가 전체 / beta 보다 작아지면 다시 top-down 으로 바꾼다
+     */
+    struct direction_options {
+        std::size_t alpha = 15;
+        std::size_t beta = 18;
+    };
+
+    /**
+     * @brief 방향 최적화 BFS - source 에서의 깊이 (도달 못 하면 unreached)
+     * @details 프론티어가 커지면 미방문 노드가 이웃 중 프론티어를 찾는 bottom-up 단계로 바꿔
+     *          간선 검사 수를 줄인다. bottom-up 은 들어오는 간선을 이웃으로 보므로 인접이 대칭이어야 한다
+     *          (접힘선 패턴처럼 양방향으로 연결된 그래프).
+     */
+    template<adjacency_graph Graph>
+    std::vector<std::uint32_t> direction_optimizing_bfs(const Graph& graph, vertex source,
+                                                        const direction_options& options = {}) {
+        const std::size_t nodes = graph.node_count();
+        if (source >= nodes) throw std::out_of_range("direction_optimizing_bfs: source out of range");
+
+        std::vector<std::uint32_t> depths(nodes, unreached);
+        std::vector<vertex> frontier{source};
+        std::vector<vertex> next;
+        visited_set in_frontier(nodes);
+        visited_set in_next(nodes);
+        depths[source] = 0;
+
+        std::size_t unexplored_edges = 0;
+        if constexpr (requires { { graph.edge_count() } -> std::convertible_to<std::size_t>; }) {
+            unexplored_edges = graph.edge_count();
+        } else {
+            for (vertex v = 0; v < nodes; ++v) unexplored_edges += graph.neighbors(v).size();
+        }
+
+        bool bottom_up = false;
+        std::uint32_t depth = 0;
+        std::size_t frontier_size = 1;
+        std::size_t frontier_edges = graph.neighbors(source).size();
+
+        while (frontier_size > 0) {
+            if (!bottom_up && frontier_edges > unexplored_edges / options.alpha) {
+                bottom_up = true;
+                in_frontier.reset(nodes);
+                for (vertex v : frontier) in_frontier.set(v);
+            } else if (bottom_up && frontier_size < nodes / options.beta) {
+                bottom_up = false;
+                frontier.clear();
+                for (vertex v = 0; v < nodes; ++v) {
+                    if (in_frontier.test(v)) frontier.push_back(v);
+                }
+            }
+
+            unexplored_edges -= std::min(unexplored_edges, frontier_edges);
+            std::size_t next_size = 0;
+            std::size_t next_edges = 0;
+
+            if (bottom_up) {
+                in_next.reset(nodes);
+                for (vertex v = 0; v < nodes; ++v) {
+                    if (depths[v] != unreached) continue;
+                    for (vertex u : graph.neighbors(v)) {
+                        if (in_frontier.test(u)) {
+                            depths[v] = depth + 1;
+                            in_next.set(v);
+                            ++next_size;
+                            next_edges += graph.neighbors(v).size();
+                            break;
+                        }
+                    }
+                }
+                std::swap(in_frontier, in_next);
+            } else {
+                next.clear();
+                for (vertex v : frontier) {
+                    for (vertex u : graph.neighbors(v)) {
+                        if (depths[u] == unreached) {
+                            depths[u] = depth + 1;
+                            next.push_back(u);
+                            next_edges += graph.neighbors(u).size();
+                        }
+                    }
+                }
+                next_size = next.size();
+                std::swap(frontier, next);
+            }
+
+            frontier_size = next_size;
+            frontier_edges = next_edges;
+            ++depth;
+        }
+        return depths;
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file include/origami/graph_ordering.hpp
+ * @brief 메모리 지역성을 위한 노드 재배치 순서 - BFS, 역 Cuthill-McKee, Hilbert 곡선
+ * @details 모든 함수는 order[새 번호] = 이전 번호 형태의 순열을 반환하며
+ *          origami_composite::reorder 에 그대로 넘길 수 있다. 이웃 노드가 가까운 번호를 갖게 되어
+ *          연결 방문이 인접한 메모리를 건드린다.
+ */
+
+#pragma once
+
+#include <origami/graph_algorithms.hpp>
+#include <origami/miura_lattice.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace metaloki::origami::graph {
+
+    /**
+     * @brief 순열의 역 - inverse[order[i]] = i (이전 번호 → 새 번호)
+     */
+    template<typename Index>
+    std::vector<Index> inverse_permutation(std::span<const Index> order) {
+        std::vector<Index> inverse(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i) inverse[order[i]] = static_cast<Index>(i);
+        return inverse;
+    }
+
+    /**
+     * @brief BFS 방문 순서 - source 의 요소부터, 남은 요소는 가장 작은 노드 번호에서 다시 시작
+     */
+    template<adjacency_graph Graph>
+    std::vector<vertex> bfs_order(const Graph& graph, vertex source = 0) {
+        const std::size_t nodes = graph.node_count();
+        std::vector<vertex> order;
+        order.reserve(nodes);
+        if (nodes == 0) return order;
+        if (source >= nodes) throw std::out_of_range("bfs_order: source out of range");
+
+        visited_set placed(nodes);
+        auto sweep = [&](vertex start) {
+            std::size_t head = order.size();
+            placed.set(start);
+            order.push_back(start);
+            for (; head < order.size(); ++head) {
+                for (vertex next : graph.neighbors(order[head])) {
+                    if (!placed.test_and_set(next)) order.push_back(next);
+                }
+            }
+        };
+
+        sweep(source);
+        for (vertex v = 0; v < nodes; ++v) {
+            if (!placed.test(v)) sweep(v);
+        }
+        return order;
+    }
+
+    /**
+     * @brief 역 Cuthill-McKee 순서 - 인접 행렬의 대역폭(이웃 번호 차)을 줄인다
+     * @details 요소마다 의사 주변 노드(BFS 마지막 레벨의 최소 차수 노드로 이심률이 늘지 않을 때까지 이동)에서
+     *          시작해, 꺼낸 노드의 새 이웃을 차수 오름차순으로 붙이고 마지막에 전체를 뒤집는다.
+     *          인접이 대칭이라고 가정한다.
+     */
+    template<adjacency_graph Graph>
+    std::vector<vertex> reverse_cuthill_mckee(const Graph& graph) {
+        const std::size_t nodes = graph.node_count();
+        std::vector<vertex> order;
+        order.reserve(nodes);
+
+        visited_set placed(nodes);
+        std::vector<std::uint32_t> stamp(nodes, 0);  // 의사 주변 노드 탐색용 방문 표시 - 검색마다 초기화 없이 재사용
+        std::vector<vertex> queue;
+        std::uint32_t search = 0;
+
+        auto degree_of = [&graph](vertex v) { return graph.neighbors(v).size(); };
+
+        // root 에서 BFS 하고 (이심률, 마지막 레벨의 최소 차수 노드)
+        auto farthest = [&](vertex root) {
+            ++search;
+            queue.clear();
+            queue.push_back(root);
+            stamp[root] = search;
+
+            std::uint32_t depth = 0;
+            std::size_t level_begin = 0;
+            for (std::size_t head = 0; head < queue.size(); ++depth) {
+                level_begin = head;
+                const std::size_t level_end = queue.size();
+                for (; head < level_end; ++head) {
+                    for (vertex next : graph.neighbors(queue[head])) {
+                        if (stamp[next] != search) {
+                            stamp[next] = search;
+                            queue.push_back(next);
+                        }
+                    }
+                }
+            }
+
+            vertex best = queue[level_begin];
+            for (std::size_t i = level_begin + 1; i < queue.size(); ++i) {
+                if (degree_of(queue[i]) < degree_of(best)) best = queue[i];
+            }
+            return std::pair{depth, best};
+        };
+
+        for (vertex start = 0; start < nodes; ++start) {
+            if (placed.test(start)) continue;
+
+            vertex root = start;
+            auto [eccentricity, candidate] = farthest(root);
+            while (candidate != root) {
+                const auto [next_eccentricity, next_candidate] = farthest(candidate);
+                if (next_eccentricity <= eccentricity) break;
+                root = candidate;
+                eccentricity = next_eccentricity;
+                candidate = next_candidate;
+            }
+
+            std::size_t head = order.size();
+            placed.set(root);
+            order.push_back(root);
+            for (; head < order.size(); ++head) {
+                const std::size_t first_new = order.size();
+                for (vertex next : graph.neighbors(order[head])) {
+                    if (!placed.test_and_set(next)) order.push_back(next);
+                }
+                std::sort(order.begin() + static_cast<std::ptrdiff_t>(first_new), order.end(),
+                          [&degree_of](vertex a, vertex b) {
+                              const auto da = degree_of(a);
+                              const auto db = degree_of(b);
+                              return da != db ? da < db : a < b;
+                          });
+            }
+        }
+
+        std::reverse(order.begin(), order.end());
+        return order;
+    }
+
+    // side x side (2 의 거듭제곱) 격자에서 (x, y) 의 Hilbert 곡선 위치
+    constexpr std::uint64_t hilbert_index(std::uint64_t side, std::uint64_t x, std::uint64_t y) noexcept {
+        std::uint64_t distance = 0;
+        for (std::uint64_t s = side / 2; s > 0; s /= 2) {
+            const std::uint64_t rx = (x & s) ? 1 : 0;
+            const std::uint64_t ry = (y & s) ? 1 : 0;
+            distance += s * s * ((3 * rx) ^ ry);
+            if (ry == 0) {
+                if (rx == 1) {
+                    x = side - 1 - x;
+                    y = side - 1 - y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return distance;
+    }
+
+    /**
+     * @brief 격자 노드(행 우선 번호)의 Hilbert 곡선 순서
+     * @details 격자를 덮는 2 의 거듭제곱 정사각형의 곡선 위치로 정렬하므로 직사각형 격자도
+     *          O(n log n) 이다. 곡선상 이웃 노드는 격자 이웃이어서 행 우선보다 2차원 지역성이 좋다.
+     */
+    inline std::vector<vertex> hilbert_order(const miura_lattice& lattice) {
+        const std::size_t nodes = lattice.node_count();
+        if (nodes >= no_vertex) throw std::length_error("hilbert_order supports fewer than 2^32 - 1 nodes");
+
+        const std::uint64_t side = std::bit_ceil(std::max<std::uint64_t>({lattice.width(), lattice.height(), 1}));
+        std::vector<std::pair<std::uint64_t, vertex>> keyed;
+        keyed.reserve(nodes);
+        for (std::size_t y = 0; y < lattice.height(); ++y) {
+            for (std::size_t x = 0; x < lattice.width(); ++x) {
+                keyed.emplace_back(hilbert_index(side, x, y), static_cast<vertex>(lattice.index(x, y)));
+            }
+        }
+        std::sort(keyed.begin(), keyed.end());
+
+        std::vector<vertex> order;
+        order.reserve(nodes);
+        for (const auto& entry : keyed) order.push_back(entry.second);
+        return order;
+    }
+}
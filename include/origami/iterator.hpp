@@ -9,10 +9,10 @@
 #include <core/typelist.hpp>
 #include <core/policy_host.hpp>
 #include <origami/composite.hpp>
+#include <origami/small_buffer.hpp>
 #include <iterator>
 #include <concepts>
 #include <functional>
-#include <stack>
 
 namespace metaloki::origami {
     
@@ -29,6 +29,8 @@ namespace metaloki::origami {
     /**
      * @brief 검색 결과 [5] "iterator_concept" 태그 구현
      * @details C++20 표준 iterator 요구사항 준수
+     *          루트에서 시작해 전체 트리를 전위 순회한다. 자식 리스트가 ValueType 의 연속 배열인
+     *          노드(직접 children() 을 갖거나 그런 대안을 담은 variant)만 하강한다.
      */
     template<typename ValueType>
     class origami_iterator {
@@ -37,20 +39,29 @@ namespace metaloki::origami {
         using iterator_concept = std::forward_iterator_tag;
         using iterator_category = std::forward_iterator_tag;
         using difference_type = std::ptrdiff_t;
-        using value_type = ValueType;
-        using pointer = value_type*;
-        using reference = value_type&;
+        using value_type = std::remove_cv_t<ValueType>;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+        
+        // 힙 spill 없이 처리되는 최대 깊이
+        static constexpr std::size_t inline_depth = 32;
         
     private:
+        // 아직 방문하지 않은 형제 구간 [next, end)
+        struct sibling_range {
+            pointer next;
+            pointer end;
+        };
+        
         // 검색 결과 [8] "private pointer m_ptr" 개념 확장
         pointer current_ptr_;
-        std::stack<pointer> traversal_stack_;
+        inline_stack<sibling_range, inline_depth> traversal_stack_;
         
     public:
         // 검색 결과 [3] "Default constructor is required"
         origami_iterator() : current_ptr_(nullptr) {}
         
-        // 특정 요소를 가리키는 생성자
+        // 특정 요소(서브트리 루트)를 가리키는 생성자
         explicit origami_iterator(pointer ptr) : current_ptr_(ptr) {}
         
         // 검색 결과 [8] "reference operator*() const"
@@ -80,28 +91,43 @@ namespace metaloki::origami {
         }
         
         // 검색 결과 [3] "==operator" (C++20 auto-generates !=)
-        auto operator<=>(const origami_iterator&) const = default;
         bool operator==(const origami_iterator& other) const {
             return current_ptr_ == other.current_ptr_;
         }
         
     private:
+        // 현재 노드의 자식 구간 - 하강할 수 없으면 빈 구간
+        static sibling_range children_of(reference node) {
+            if constexpr (detail::has_children_of<value_type, value_type>) {
+                auto& children = node.children();
+                return {children.data(), children.data() + children.size()};
+            } else if constexpr (requires { std::variant_size<value_type>::value; }) {
+                return std::visit([](auto& alternative) -> sibling_range {
+                    using alternative_type = std::remove_cvref_t<decltype(alternative)>;
+                    if constexpr (detail::has_children_of<alternative_type, value_type>) {
+                        auto& children = alternative.children();
+                        return {children.data(), children.data() + children.size()};
+                    } else {
+                        return {nullptr, nullptr};
+                    }
+                }, node);
+            } else {
+                return {nullptr, nullptr};
+            }
+        }
+        
         // ORIGAMI 특화 순회 로직
         void advance_to_next() {
             if (!current_ptr_) return;
             
-            // 복합 구조의 경우 깊이 우선 순회
-            if constexpr (requires { current_ptr_->children(); }) {
-                auto& children = current_ptr_->children();
-                if (!children.empty()) {
-                    // 현재 위치를 스택에 저장
-                    traversal_stack_.push(current_ptr_);
-                    // 첫 번째 자식으로 이동
-                    std::visit([this](auto&& child) {
-                        current_ptr_ = &child;
-                    }, children[0]);
-                    return;
+            // 복합 구조의 경우 깊이 우선 순회 - 첫 번째 자식으로 이동하고 나머지 형제를 보관
+            const auto children = children_of(*current_ptr_);
+            if (children.next != children.end) {
+                current_ptr_ = children.next;
+                if (children.next + 1 != children.end) {
+                    traversal_stack_.push({children.next + 1, children.end});
                 }
+                return;
             }
             
             // 형제나 부모의 다음 형제로 이동
@@ -109,30 +135,18 @@ namespace metaloki::origami {
         }
         
         void move_to_next_sibling_or_parent() {
-            // 스택을 활용한 백트래킹
-            while (!traversal_stack_.empty()) {
-                auto parent = traversal_stack_.top();
-                traversal_stack_.pop();
-                
-                // 부모의 다음 형제 찾기 로직
-                if (has_next_sibling(parent)) {
-                    current_ptr_ = get_next_sibling(parent);
-                    return;
-                }
+            // 스택에는 남은 형제가 있는 구간만 존재하므로 top 이 곧 다음 노드
+            if (traversal_stack_.empty()) {
+                // 더 이상 순회할 요소 없음
+                current_ptr_ = nullptr;
+                return;
             }
             
-            // 더 이상 순회할 요소 없음
-            current_ptr_ = nullptr;
-        }
-        
-        bool has_next_sibling(pointer parent) const {
-            // 실제 구현에서는 부모-자식 관계를 통해 판단
-            return false; // 단순화된 구현
-        }
-        
-        pointer get_next_sibling(pointer parent) const {
-            // 실제 구현에서는 부모의 다음 자식 반환
-            return nullptr; // 단순화된 구현
+            auto& siblings = traversal_stack_.top();
+            current_ptr_ = siblings.next++;
+            if (siblings.next == siblings.end) {
+                traversal_stack_.pop();
+            }
         }
     };
     
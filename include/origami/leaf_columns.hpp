@@ -0,0 +1,90 @@
+/**
+ * @file include/origami/leaf_columns.hpp
+ * @brief 서브트리의 leaf<T> 값을 연속 열(column)로 모은 그림자 색인
+ * @details 분석용 질의(합계, 평균, 최솟값/최댓값)는 트리를 돌며 variant 를 하나씩 풀 필요 없이
+ *          값 배열 하나를 훑으면 된다. 열은 값과 그 값의 노드 id(서브트리 전위 순서, 루트 = 0)를
+ *          나란히 보관하고, 리덕션은 독립 누산기 여러 개로 돌아 컴파일러가 SIMD 로 바꿀 수 있다.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace metaloki::origami {
+
+    template<typename T>
+    class leaf_column {
+    private:
+        std::vector<T> values_;
+        std::vector<std::uint32_t> node_ids_;
+
+        // 누산기 개수 - 부동소수점 덧셈도 의존 사슬이 끊겨 벡터 레지스터에 나란히 들어간다
+        static constexpr std::size_t lanes = 8;
+
+    public:
+        leaf_column() = default;
+
+        void reserve(std::size_t count) {
+            values_.reserve(count);
+            node_ids_.reserve(count);
+        }
+
+        void push_back(const T& value, std::uint32_t node_id) {
+            values_.push_back(value);
+            node_ids_.push_back(node_id);
+        }
+
+        std::span<const T> values() const noexcept { return values_; }
+        std::span<const std::uint32_t> node_ids() const noexcept { return node_ids_; }
+        std::size_t size() const noexcept { return values_.size(); }
+        bool empty() const noexcept { return values_.empty(); }
+
+        // 값의 합 - aggregates::sum<T> 와 같은 결과 타입
+        T sum() const requires std::is_arithmetic_v<T> {
+            const T* data = values_.data();
+            const std::size_t count = values_.size();
+            const std::size_t blocked = count - count % lanes;
+
+            T partial[lanes] = {};
+            for (std::size_t i = 0; i < blocked; i += lanes) {
+                for (std::size_t lane = 0; lane < lanes; ++lane) partial[lane] += data[i + lane];
+            }
+
+            T total{};
+            for (std::size_t lane = 0; lane < lanes; ++lane) total += partial[lane];
+            for (std::size_t i = blocked; i < count; ++i) total += data[i];
+            return total;
+        }
+
+        // 산술 평균 - 값이 없으면 nullopt
+        std::optional<double> mean() const requires std::is_arithmetic_v<T> {
+            if (values_.empty()) return std::nullopt;
+            return static_cast<double>(sum()) / static_cast<double>(values_.size());
+        }
+
+        std::optional<T> min() const requires std::is_arithmetic_v<T> {
+            if (values_.empty()) return std::nullopt;
+            return *std::min_element(values_.begin(), values_.end());
+        }
+
+        std::optional<T> max() const requires std::is_arithmetic_v<T> {
+            if (values_.empty()) return std::nullopt;
+            return *std::max_element(values_.begin(), values_.end());
+        }
+
+        // predicate 를 만족하는 값의 수 - 분기 없는 누적
+        template<typename Predicate>
+        std::size_t count_if(Predicate predicate) const {
+            std::size_t matches = 0;
+            for (const T& value : values_) matches += predicate(value) ? 1 : 0;
+            return matches;
+        }
+    };
+}
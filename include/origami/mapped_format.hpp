@@ -0,0 +1,716 @@
+/**
+ * @file include/origami/mapped_format.hpp
+ * @brief composite / origami_composite 의 mmap 가능한 바이너리 형식 (쓰기 + zero-copy 읽기)
+ * @details 파일은 헤더와 8바이트 정렬된 섹션들로 이뤄지며 모든 참조는 파일 시작 기준 오프셋이다.
+ *
+ *          composite 트리:
+ *            - 노드 테이블: 레벨 순서로 배치해 한 노드의 자식들이 연속 구간을 이룬다
+ *            - variant 태그 배열: 노드마다 부모 variant 에서의 대안 인덱스 (uint16)
+ *            - leaf 값 아레나: trivially copyable 값은 정렬된 원본 바이트 그대로
+ *            - 문자열 테이블: composite 이름과 leaf<std::string> 값 (중복 제거)
+ *          origami_composite 패턴:
+ *            - 요소 배열 + CSR 연결 (오프셋 n+1 개, 이웃 인덱스 m 개) + 패턴 이름
+ *
+ *          읽기 쪽 view 는 역직렬화 없이 매핑된 바이트를 직접 가리키며,
+ *          바이트 버퍼(또는 mapped_file)가 view 와 그 ref 들보다 오래 살아 있어야 한다.
+ *          리틀 엔디안 전용이다.
+ */
+
+#pragma once
+
+#include <origami/composite.hpp>
+#include <origami/origami_composite.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace metaloki::origami::binary {
+
+    static_assert(std::endian::native == std::endian::little, "mapped format assumes a little-endian host");
+
+    inline constexpr std::array<char, 8> file_magic = {'L', 'O', 'K', 'I', 'O', 'R', 'G', '\0'};
+    inline constexpr std::uint32_t format_version = 1;
+
+    enum class payload_kind : std::uint32_t {
+        composite_tree = 1,
+        origami_pattern = 2
+    };
+
+    struct section {
+        std::uint64_t offset = 0;
+        std::uint64_t size = 0;  // 바이트
+    };
+
+    /**
+     * @brief 파일 헤더
+     * @details 트리: primary = 노드 테이블, secondary = 태그, arena = leaf 값
+     *          패턴: primary = 요소 배열, secondary = CSR 오프셋, arena = 이웃 인덱스
+     */
+    struct file_header {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        payload_kind kind;
+        std::uint64_t schema;      // 저장한 타입 구성의 지문 - 읽는 쪽 타입과 일치해야 함
+        std::uint64_t node_count;
+        std::uint64_t edge_count;
+        section primary;
+        section secondary;
+        section arena;
+        section string_offsets;    // uint64[count + 1]
+        section string_bytes;
+    };
+
+    // 트리 노드 레코드
+    struct tree_node {
+        std::uint64_t first_child;  // 자식 구간 시작 노드 인덱스
+        std::uint32_t child_count;
+        std::uint32_t name;         // composite 이름의 문자열 id (그 외 no_string)
+        std::uint64_t payload;      // leaf 값의 아레나 오프셋 또는 문자열 id
+    };
+
+    inline constexpr std::uint32_t no_string = 0xFFFFFFFFu;
+    inline constexpr std::uint16_t root_tag = 0xFFFFu;
+
+    namespace detail {
+        using origami::detail::composite_base_t;
+        using origami::detail::composite_tree;
+
+        template<typename Element>
+        struct leaf_value {};
+
+        template<typename T>
+        struct leaf_value<leaf<T>> {
+            using type = T;
+        };
+
+        template<typename Element>
+        concept value_leaf = requires { typename leaf_value<Element>::type; }
+            && std::is_trivially_copyable_v<typename leaf_value<Element>::type>;
+
+        template<typename Element>
+        concept string_leaf = std::is_same_v<Element, leaf<std::string>>;
+
+        template<typename Element>
+        concept encodable = value_leaf<Element> || string_leaf<Element> || composite_tree<Element>;
+
+        constexpr std::uint64_t mix(std::uint64_t hash, std::uint64_t value) {
+            for (int i = 0; i < 8; ++i) {
+                hash ^= (value >> (i * 8)) & 0xFF;
+                hash *= 0x100000001B3ull;
+            }
+            return hash;
+        }
+
+        template<typename Composite>
+        struct composite_schema;
+
+        // 저장 가능한 타입의 구조 지문 (FNV-1a)
+        template<typename Element>
+        constexpr std::uint64_t schema_of(std::uint64_t hash = 0xCBF29CE484222325ull) {
+            static_assert(encodable<Element>,
+                "mapped format supports leaf<trivially copyable>, leaf<std::string> and nested composite children");
+
+            if constexpr (string_leaf<Element>) {
+                return mix(hash, 2);
+            } else if constexpr (value_leaf<Element>) {
+                using value_type = typename leaf_value<Element>::type;
+                hash = mix(hash, std::is_arithmetic_v<value_type> ? 1 : 4);
+                hash = mix(hash, sizeof(value_type));
+                hash = mix(hash, alignof(value_type));
+                return mix(hash, std::is_floating_point_v<value_type> * 2 + std::is_signed_v<value_type>);
+            } else {
+                return composite_schema<composite_base_t<Element>>::apply(hash);
+            }
+        }
+
+        template<std::size_t InlineChildren, Component... ChildTypes>
+        struct composite_schema<basic_composite<InlineChildren, ChildTypes...>> {
+            static constexpr std::uint64_t apply(std::uint64_t hash) {
+                hash = mix(hash, 3);
+                hash = mix(hash, sizeof...(ChildTypes));
+                ((hash = schema_of<ChildTypes>(hash)), ...);
+                return hash;
+            }
+        };
+
+        template<typename ElementType>
+        constexpr std::uint64_t pattern_schema() {
+            std::uint64_t hash = mix(0xCBF29CE484222325ull, 5);
+            hash = mix(hash, sizeof(ElementType));
+            return mix(hash, alignof(ElementType));
+        }
+
+        constexpr std::uint64_t align_up(std::uint64_t value, std::uint64_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        /**
+         * @brief 섹션 버퍼를 모아 최종 이미지를 만드는 작성기
+         */
+        class image_builder {
+        private:
+            std::vector<std::byte> arena_;
+            std::vector<std::uint64_t> string_offsets_{0};
+            std::vector<char> string_bytes_;
+            std::unordered_map<std::string, std::uint32_t> interned_;
+
+            static section place(std::vector<std::byte>& image, const void* data, std::size_t size) {
+                const std::uint64_t offset = align_up(image.size(), 64);
+                image.resize(offset + size);
+                if (size) std::memcpy(image.data() + offset, data, size);
+                return {offset, size};
+            }
+
+        public:
+            std::uint32_t intern(std::string_view text) {
+                auto [it, inserted] = interned_.try_emplace(std::string(text), 0);
+                if (inserted) {
+                    it->second = static_cast<std::uint32_t>(string_offsets_.size() - 1);
+                    string_bytes_.insert(string_bytes_.end(), text.begin(), text.end());
+                    string_offsets_.push_back(string_bytes_.size());
+                }
+                return it->second;
+            }
+
+            template<typename T>
+            std::uint64_t put(const T& value) {
+                const std::uint64_t offset = align_up(arena_.size(), alignof(T));
+                arena_.resize(offset + sizeof(T));
+                std::memcpy(arena_.data() + offset, &value, sizeof(T));
+                return offset;
+            }
+
+            template<typename Primary, typename Secondary>
+            std::vector<std::byte> finish(file_header header,
+                                          const std::vector<Primary>& primary,
+                                          const std::vector<Secondary>& secondary) {
+                std::vector<std::byte> image(sizeof(file_header));
+                header.primary = place(image, primary.data(), primary.size() * sizeof(Primary));
+                header.secondary = place(image, secondary.data(), secondary.size() * sizeof(Secondary));
+                header.arena = place(image, arena_.data(), arena_.size());
+                header.string_offsets = place(image, string_offsets_.data(), string_offsets_.size() * sizeof(std::uint64_t));
+                header.string_bytes = place(image, string_bytes_.data(), string_bytes_.size());
+                image.resize(align_up(image.size(), 8));
+                std::memcpy(image.data(), &header, sizeof(file_header));
+                return image;
+            }
+        };
+
+        inline file_header make_header(payload_kind kind, std::uint64_t schema,
+                                       std::uint64_t node_count, std::uint64_t edge_count) {
+            file_header header{};
+            header.magic = file_magic;
+            header.version = format_version;
+            header.kind = kind;
+            header.schema = schema;
+            header.node_count = node_count;
+            header.edge_count = edge_count;
+            return header;
+        }
+
+        /**
+         * @brief 레벨 순서 트리 인코더 - 중첩 composite 타입마다 다른 자식 variant 를 함수 포인터로 처리
+         */
+        class tree_encoder {
+        private:
+            struct pending {
+                const void* composite;
+                void (*emit)(tree_encoder&, const void*, std::uint64_t);
+                std::uint64_t index;
+            };
+
+            image_builder builder_;
+            std::vector<tree_node> nodes_;
+            std::vector<std::uint16_t> tags_;
+            std::vector<pending> queue_;
+
+            template<typename Composite>
+            static void emit_children(tree_encoder& self, const void* object, std::uint64_t index) {
+                const auto& source = *static_cast<const Composite*>(object);
+                const auto& children = source.children();
+
+                self.nodes_[index].first_child = self.nodes_.size();
+                self.nodes_[index].child_count = static_cast<std::uint32_t>(children.size());
+
+                for (const auto& child : children) {
+                    std::visit([&self, tag = child.index()](const auto& element) {
+                        self.push(element, static_cast<std::uint16_t>(tag));
+                    }, child);
+                }
+            }
+
+            template<typename Element>
+            void push(const Element& element, std::uint16_t tag) {
+                tree_node record{0, 0, no_string, 0};
+
+                if constexpr (string_leaf<Element>) {
+                    record.payload = builder_.intern(element.value());
+                } else if constexpr (value_leaf<Element>) {
+                    record.payload = builder_.put(element.value());
+                } else {
+                    using base = composite_base_t<Element>;
+                    record.name = builder_.intern(element.name());
+                    queue_.push_back({static_cast<const base*>(&element), &emit_children<base>, nodes_.size()});
+                }
+
+                nodes_.push_back(record);
+                tags_.push_back(tag);
+            }
+
+        public:
+            template<typename Tree>
+            std::vector<std::byte> encode(const Tree& tree) {
+                using base = composite_base_t<Tree>;
+
+                push(static_cast<const base&>(tree), root_tag);
+                for (std::size_t head = 0; head < queue_.size(); ++head) {
+                    const pending current = queue_[head];
+                    current.emit(*this, current.composite, current.index);
+                }
+
+                auto header = make_header(payload_kind::composite_tree, schema_of<base>(), nodes_.size(), 0);
+                return builder_.finish(header, nodes_, tags_);
+            }
+        };
+
+        // [offset, offset + size) 가 limit 안에 있는지 - 헤더 값끼리 더해 넘치지 않게 뺄셈으로 비교
+        constexpr bool fits(std::uint64_t offset, std::uint64_t size, std::uint64_t limit) noexcept {
+            return offset <= limit && size <= limit - offset;
+        }
+
+        // record_size 바이트 레코드 count 개가 available 바이트에 들어가는지 - 곱셈 대신 나눗셈으로 비교
+        constexpr bool holds_records(std::uint64_t available, std::uint64_t count, std::uint64_t record_size) noexcept {
+            return count <= available / record_size;
+        }
+
+        /**
+         * @brief 검증된 이미지의 섹션 포인터 묶음 (ref 들이 값으로 복사해 들고 다님)
+         */
+        struct mapped_image {
+            const std::byte* base = nullptr;
+            const file_header* header = nullptr;
+            const std::byte* primary = nullptr;
+            const std::byte* secondary = nullptr;
+            const std::byte* arena = nullptr;
+            const std::uint64_t* string_offsets = nullptr;
+            const char* string_bytes = nullptr;
+
+            std::string_view string(std::uint32_t id) const {
+                const std::uint64_t count = header->string_offsets.size / sizeof(std::uint64_t) - 1;
+                if (id >= count) {
+                    throw std::out_of_range("mapped format: string id out of range");
+                }
+                const std::uint64_t first = string_offsets[id];
+                const std::uint64_t last = string_offsets[id + 1];
+                if (first > last || last > header->string_bytes.size) {
+                    throw std::runtime_error("mapped format: corrupt string offsets");
+                }
+                return {string_bytes + first, last - first};
+            }
+
+            template<typename T>
+            const T& at_arena(std::uint64_t offset) const {
+                if (!fits(offset, sizeof(T), header->arena.size) || offset % alignof(T) != 0) {
+                    throw std::out_of_range("mapped format: payload offset out of range");
+                }
+                return *reinterpret_cast<const T*>(arena + offset);
+            }
+        };
+
+        inline mapped_image open_image(std::span<const std::byte> bytes, payload_kind kind, std::uint64_t schema) {
+            if (bytes.size() < sizeof(file_header) || reinterpret_cast<std::uintptr_t>(bytes.data()) % 8 != 0) {
+                throw std::runtime_error("mapped format: buffer too small or misaligned");
+            }
+
+            mapped_image image;
+            image.base = bytes.data();
+            image.header = reinterpret_cast<const file_header*>(bytes.data());
+
+            const auto& header = *image.header;
+            if (header.magic != file_magic || header.version != format_version) {
+                throw std::runtime_error("mapped format: bad magic or unsupported version");
+            }
+            if (header.kind != kind || header.schema != schema) {
+                throw std::runtime_error("mapped format: payload does not match the requested type");
+            }
+
+            for (const section* part : {&header.primary, &header.secondary, &header.arena,
+                                        &header.string_offsets, &header.string_bytes}) {
+                if (part->offset % 8 != 0 || !fits(part->offset, part->size, bytes.size())) {
+                    throw std::runtime_error("mapped format: section out of bounds");
+                }
+            }
+            if (header.string_offsets.size < sizeof(std::uint64_t)) {
+                throw std::runtime_error("mapped format: missing string table");
+            }
+
+            image.primary = bytes.data() + header.primary.offset;
+            image.secondary = bytes.data() + header.secondary.offset;
+            image.arena = bytes.data() + header.arena.offset;
+            image.string_offsets = reinterpret_cast<const std::uint64_t*>(bytes.data() + header.string_offsets.offset);
+            image.string_bytes = reinterpret_cast<const char*>(bytes.data() + header.string_bytes.offset);
+
+            const std::uint64_t strings = header.string_offsets.size / sizeof(std::uint64_t);
+            if (image.string_offsets[strings - 1] > header.string_bytes.size) {
+                throw std::runtime_error("mapped format: string table out of bounds");
+            }
+            return image;
+        }
+    }
+
+    template<typename Composite>
+    class composite_ref;
+
+    /**
+     * @brief 매핑된 트리의 노드 하나 - 부모 variant 의 대안 중 하나
+     * @details get<leaf<T>>() 는 아레나의 값을 const T& 로, get<leaf<std::string>>() 은
+     *          문자열 테이블의 string_view 로, get<composite<...>>() 는 composite_ref 로 반환한다.
+     */
+    template<Component... ChildTypes>
+    class node_ref {
+    private:
+        detail::mapped_image image_;
+        std::uint64_t index_ = 0;
+
+        const tree_node& record() const {
+            return reinterpret_cast<const tree_node*>(image_.primary)[index_];
+        }
+
+        template<typename Element>
+        static constexpr std::size_t alternative_of() {
+            constexpr std::array<bool, sizeof...(ChildTypes)> matches{std::is_same_v<Element, ChildTypes>...};
+            for (std::size_t i = 0; i < matches.size(); ++i) {
+                if (matches[i]) return i;
+            }
+            return sizeof...(ChildTypes);
+        }
+
+        template<typename Function, std::size_t... Indices>
+        decltype(auto) dispatch(Function&& function, std::index_sequence<Indices...>) const {
+            using result_type = std::invoke_result_t<Function,
+                decltype(std::declval<const node_ref&>().template get<std::tuple_element_t<0, std::tuple<ChildTypes...>>>())>;
+
+            const std::size_t tag = index();
+            if constexpr (std::is_void_v<result_type>) {
+                ((tag == Indices ? (function(get<ChildTypes>()), true) : false) || ...);
+            } else {
+                std::optional<result_type> result;
+                ((tag == Indices ? (result.emplace(function(get<ChildTypes>())), true) : false) || ...);
+                return *std::move(result);
+            }
+        }
+
+    public:
+        node_ref(const detail::mapped_image& image, std::uint64_t index) : image_(image), index_(index) {}
+
+        // 부모 variant 에서의 대안 인덱스 (std::variant::index 와 동일)
+        std::size_t index() const {
+            const std::uint16_t tag = reinterpret_cast<const std::uint16_t*>(image_.secondary)[index_];
+            if (tag >= sizeof...(ChildTypes)) {
+                throw std::runtime_error("mapped format: invalid variant tag");
+            }
+            return tag;
+        }
+
+        template<typename Element>
+        bool holds() const {
+            return index() == alternative_of<Element>();
+        }
+
+        template<typename Element>
+        decltype(auto) get() const {
+            static_assert(alternative_of<Element>() < sizeof...(ChildTypes), "Element must be one of the child types");
+            if (!holds<Element>()) {
+                throw std::bad_variant_access();
+            }
+
+            if constexpr (detail::string_leaf<Element>) {
+                return image_.string(static_cast<std::uint32_t>(record().payload));
+            } else if constexpr (detail::value_leaf<Element>) {
+                return image_.template at_arena<typename detail::leaf_value<Element>::type>(record().payload);
+            } else {
+                return composite_ref<detail::composite_base_t<Element>>(image_, index_);
+            }
+        }
+
+        // 실제 대안에 맞춰 function(get<E>()) 호출
+        template<typename Function>
+        decltype(auto) visit(Function&& function) const {
+            return dispatch(std::forward<Function>(function), std::index_sequence_for<ChildTypes...>{});
+        }
+    };
+
+    /**
+     * @brief 매핑된 composite 노드
+     */
+    template<std::size_t InlineChildren, Component... ChildTypes>
+    class composite_ref<basic_composite<InlineChildren, ChildTypes...>> {
+    private:
+        detail::mapped_image image_;
+        std::uint64_t index_ = 0;
+
+        const tree_node& record() const {
+            return reinterpret_cast<const tree_node*>(image_.primary)[index_];
+        }
+
+    public:
+        using child_ref = node_ref<ChildTypes...>;
+
+        composite_ref(const detail::mapped_image& image, std::uint64_t index) : image_(image), index_(index) {
+            const auto& node = record();
+            if (!detail::fits(node.first_child, node.child_count, image_.header->node_count)) {
+                throw std::runtime_error("mapped format: child range out of bounds");
+            }
+        }
+
+        std::string_view name() const { return image_.string(record().name); }
+        std::size_t size() const { return record().child_count; }
+        bool empty() const { return size() == 0; }
+
+        child_ref operator[](std::size_t position) const {
+            if (position >= size()) {
+                throw std::out_of_range("mapped format: child index out of range");
+            }
+            return child_ref(image_, record().first_child + position);
+        }
+
+        // 자식 ref 의 random access range
+        auto children() const {
+            return std::views::iota(std::size_t{0}, size())
+                | std::views::transform([image = image_, first = record().first_child](std::size_t position) {
+                      return child_ref(image, first + position);
+                  });
+        }
+    };
+
+    /**
+     * @brief 매핑된 composite 트리 view
+     */
+    template<typename Tree>
+    class tree_view {
+    public:
+        using composite_type = detail::composite_base_t<Tree>;
+
+    private:
+        detail::mapped_image image_;
+
+        explicit tree_view(const detail::mapped_image& image) : image_(image) {}
+
+    public:
+        // 헤더와 섹션 경계를 검증 (노드 데이터는 접근할 때 검사)
+        static tree_view open(std::span<const std::byte> bytes) {
+            auto image = detail::open_image(bytes, payload_kind::composite_tree, detail::schema_of<composite_type>());
+            const auto& header = *image.header;
+            if (header.node_count == 0
+                || !detail::holds_records(header.primary.size, header.node_count, sizeof(tree_node))
+                || !detail::holds_records(header.secondary.size, header.node_count, sizeof(std::uint16_t))) {
+                throw std::runtime_error("mapped format: node table truncated");
+            }
+            return tree_view(image);
+        }
+
+        std::uint64_t node_count() const { return image_.header->node_count; }
+
+        composite_ref<composite_type> root() const { return composite_ref<composite_type>(image_, 0); }
+    };
+
+    /**
+     * @brief 매핑된 origami_composite 패턴 view - 요소와 CSR 연결을 직접 참조
+     */
+    template<typename ElementType>
+    class pattern_view {
+    private:
+        detail::mapped_image image_;
+
+        explicit pattern_view(const detail::mapped_image& image) : image_(image) {}
+
+        const std::uint64_t* offsets() const { return reinterpret_cast<const std::uint64_t*>(image_.secondary); }
+
+    public:
+        static pattern_view open(std::span<const std::byte> bytes) {
+            static_assert(std::is_trivially_copyable_v<ElementType>, "pattern elements must be trivially copyable");
+
+            auto image = detail::open_image(bytes, payload_kind::origami_pattern, detail::pattern_schema<ElementType>());
+            const auto& header = *image.header;
+            // 오프셋은 node_count + 1 개 - node_count 에 1 을 더하지 않도록 < 로 비교
+            if (!detail::holds_records(header.primary.size, header.node_count, sizeof(ElementType))
+                || header.node_count >= header.secondary.size / sizeof(std::uint64_t)
+                || !detail::holds_records(header.arena.size, header.edge_count, sizeof(std::uint64_t))
+                || reinterpret_cast<const std::uint64_t*>(image.secondary)[header.node_count] != header.edge_count) {
+                throw std::runtime_error("mapped format: pattern sections truncated");
+            }
+            return pattern_view(image);
+        }
+
+        std::size_t size() const { return image_.header->node_count; }
+        std::size_t edge_count() const { return image_.header->edge_count; }
+        std::string_view pattern_name() const { return image_.string(0); }
+
+        const ElementType& get_element(std::size_t index) const {
+            if (index >= size()) {
+                throw std::out_of_range("mapped format: node index out of range");
+            }
+            return reinterpret_cast<const ElementType*>(image_.primary)[index];
+        }
+
+        // node_index 의 연결 대상 인덱스들
+        std::span<const std::uint64_t> neighbors(std::size_t node_index) const {
+            if (node_index >= size()) {
+                throw std::out_of_range("mapped format: node index out of range");
+            }
+            const auto first = offsets()[node_index];
+            const auto last = offsets()[node_index + 1];
+            if (first > last || last > edge_count()) {
+                throw std::runtime_error("mapped format: corrupt adjacency offsets");
+            }
+            return {reinterpret_cast<const std::uint64_t*>(image_.arena) + first, last - first};
+        }
+
+        // origami_composite::visit_connections 와 같은 시그니처
+        template<typename Function>
+        void visit_connections(std::size_t node_index, Function&& func) const {
+            const ElementType& source = get_element(node_index);
+            for (std::uint64_t connected : neighbors(node_index)) {
+                func(node_index, static_cast<std::size_t>(connected), source, get_element(connected));
+            }
+        }
+    };
+
+    /**
+     * @brief composite 트리를 매핑 가능한 이미지로 직렬화
+     */
+    template<origami::detail::composite_tree Tree>
+    std::vector<std::byte> serialize(const Tree& tree) {
+        return detail::tree_encoder{}.encode(tree);
+    }
+
+    /**
+     * @brief origami_composite 패턴을 요소 배열 + CSR 연결로 직렬화
+     */
+    template<typename ElementType, typename ThreadingPolicy, typename ValidationPolicy>
+    std::vector<std::byte> serialize(const origami_composite<ElementType, ThreadingPolicy, ValidationPolicy>& pattern) {
+        static_assert(std::is_trivially_copyable_v<ElementType>, "pattern elements must be trivially copyable");
+
+        std::vector<ElementType> elements;
+        std::vector<std::uint64_t> offsets;
+        std::vector<std::uint64_t> neighbors;
+        elements.reserve(pattern.size());
+        offsets.reserve(pattern.size() + 1);
+        offsets.push_back(0);
+
+        for (std::size_t i = 0; i < pattern.size(); ++i) {
+            elements.push_back(pattern.get_element(i));
+            pattern.visit_connections(i, [&neighbors](std::size_t, std::size_t to, const auto&, const auto&) {
+                neighbors.push_back(to);
+            });
+            offsets.push_back(neighbors.size());
+        }
+
+        detail::image_builder builder;
+        builder.intern(pattern.pattern_name());  // 문자열 id 0
+        for (std::uint64_t to : neighbors) builder.put(to);
+
+        auto header = detail::make_header(payload_kind::origami_pattern, detail::pattern_schema<ElementType>(),
+                                          elements.size(), neighbors.size());
+        return builder.finish(header, elements, offsets);
+    }
+
+    // 직렬화 결과를 파일로 저장
+    template<typename Source>
+    void save(const Source& source, const std::string& path) {
+        const auto image = serialize(source);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+        if (!out) {
+            throw std::runtime_error("mapped format: failed to write " + path);
+        }
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    /**
+     * @brief 읽기 전용 파일 매핑 (RAII)
+     * @details 페이지 정렬된 주소에 매핑되므로 view 의 정렬 요구를 만족한다
+     */
+    class mapped_file {
+    private:
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+
+        void release() noexcept {
+            if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+    public:
+        explicit mapped_file(const std::string& path) {
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::system_error(errno, std::generic_category(), "mapped format: open " + path);
+            }
+
+            struct stat info {};
+            if (::fstat(fd, &info) != 0) {
+                const int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "mapped format: stat " + path);
+            }
+
+            size_ = static_cast<std::size_t>(info.st_size);
+            if (size_ > 0) {
+                void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped == MAP_FAILED) {
+                    const int error = errno;
+                    ::close(fd);
+                    throw std::system_error(error, std::generic_category(), "mapped format: mmap " + path);
+                }
+                data_ = static_cast<const std::byte*>(mapped);
+            }
+            ::close(fd);
+        }
+
+        ~mapped_file() { release(); }
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        mapped_file(mapped_file&& other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+        mapped_file& operator=(mapped_file&& other) noexcept {
+            if (this != &other) {
+                release();
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+    };
+#endif
+}
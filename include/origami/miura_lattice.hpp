@@ -0,0 +1,143 @@
+/**
+ * @file include/origami/miura_lattice.hpp
+ * @brief Miura-ori 격자의 위상을 좌표 산술로 계산
+ * @details width x height 격자의 노드 i = y * width + x 는 가로/세로 이웃과, (x + y) 가 짝수인 노드만
+ *          네 방향 대각선 이웃과 연결된다. 연결은 좌표만의 함수이므로 노드 수, 간선 수, 차수를
+ *          미리 알 수 있고, 전체 격자를 만들지 않고 원하는 창(tile)만 꺼내 볼 수 있다.
+ *          이웃 순서는 origami_composite::create_miura_pattern 이 만들던 연결 목록 순서와 같다.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+namespace metaloki::origami {
+
+    class miura_lattice {
+    private:
+        std::size_t width_ = 0;
+        std::size_t height_ = 0;
+
+    public:
+        // 노드 하나의 최대 이웃 수 (가로 2 + 세로 2 + 대각선 4)
+        static constexpr std::size_t max_degree = 8;
+
+        /**
+         * @brief 격자 창 - 원점 (x, y) 에서 width x height
+         */
+        struct tile {
+            std::size_t x = 0;
+            std::size_t y = 0;
+            std::size_t width = 0;
+            std::size_t height = 0;
+
+            constexpr std::size_t node_count() const noexcept { return width * height; }
+
+            constexpr bool contains(std::size_t px, std::size_t py) const noexcept {
+                return px - x < width && py - y < height;  // 부호 없는 뺄셈으로 양쪽 경계를 한 번에
+            }
+        };
+
+        constexpr miura_lattice() = default;
+
+        constexpr miura_lattice(std::size_t width, std::size_t height) : width_(width), height_(height) {
+            if (width != 0 && height > std::numeric_limits<std::size_t>::max() / width) {
+                throw std::length_error("miura_lattice node count overflows size_t");
+            }
+        }
+
+        constexpr std::size_t width() const noexcept { return width_; }
+        constexpr std::size_t height() const noexcept { return height_; }
+        constexpr std::size_t node_count() const noexcept { return width_ * height_; }
+        constexpr tile whole() const noexcept { return {0, 0, width_, height_}; }
+
+        // 무방향 접힘선 수 - 가로 + 세로 + 대각선
+        constexpr std::size_t edge_count() const noexcept { return edge_count(whole()); }
+
+        // 창 안에서 양 끝이 모두 창에 있는 무방향 접힘선 수
+        static constexpr std::size_t edge_count(const tile& window) noexcept {
+            if (window.width == 0 || window.height == 0) return 0;
+            const std::size_t w = window.width;
+            const std::size_t h = window.height;
+
+            // 셀마다 대각선 하나 (짝수 패리티 셀은 좌상-우하, 홀수는 우상-좌하)
+            return h * (w - 1) + (h - 1) * w + (h - 1) * (w - 1);
+        }
+
+        // 방향 연결 수 (연결 목록 항목 수) - 간선마다 양방향
+        constexpr std::size_t connection_count() const noexcept { return 2 * edge_count(); }
+
+        constexpr std::size_t index(std::size_t x, std::size_t y) const noexcept { return y * width_ + x; }
+
+        /**
+         * @brief (x, y) 의 이웃 (nx, ny) 마다 op(nx, ny) - 창 밖 이웃은 건너뛴다
+         * @details 순서: 왼쪽, 오른쪽, 위, 아래, 그리고 (x + y) 가 짝수면 좌상, 우상, 좌하, 우하
+         */
+        template<typename Operation>
+        constexpr void for_each_neighbor(std::size_t x, std::size_t y, const tile& window, Operation&& op) const {
+            const bool left = x > window.x;
+            const bool right = x + 1 < window.x + window.width;
+            const bool up = y > window.y;
+            const bool down = y + 1 < window.y + window.height;
+
+            if (left) op(x - 1, y);
+            if (right) op(x + 1, y);
+            if (up) op(x, y - 1);
+            if (down) op(x, y + 1);
+
+            if ((x + y) % 2 == 0) {
+                if (up && left) op(x - 1, y - 1);
+                if (up && right) op(x + 1, y - 1);
+                if (down && left) op(x - 1, y + 1);
+                if (down && right) op(x + 1, y + 1);
+            }
+        }
+
+        template<typename Operation>
+        constexpr void for_each_neighbor(std::size_t x, std::size_t y, Operation&& op) const {
+            for_each_neighbor(x, y, whole(), op);
+        }
+
+        // 노드 번호로 - op(neighbor_index)
+        template<typename Operation>
+        constexpr void for_each_neighbor(std::size_t node_index, Operation&& op) const {
+            const std::size_t x = node_index % width_;
+            const std::size_t y = node_index / width_;
+            for_each_neighbor(x, y, whole(), [this, &op](std::size_t nx, std::size_t ny) { op(index(nx, ny)); });
+        }
+
+        constexpr std::size_t degree(std::size_t x, std::size_t y, const tile& window) const noexcept {
+            std::size_t count = 0;
+            for_each_neighbor(x, y, window, [&count](std::size_t, std::size_t) { ++count; });
+            return count;
+        }
+
+        constexpr std::size_t degree(std::size_t x, std::size_t y) const noexcept { return degree(x, y, whole()); }
+
+        /**
+         * @brief 창 안의 무방향 접힘선을 한 번씩 op(from_x, from_y, to_x, to_y) - 행 우선, 앞쪽 노드가 from
+         * @details 격자 전체를 만들지 않고 창만 훑으므로 큰 격자의 일부를 볼 때 비용은 창 크기에 비례한다
+         */
+        template<typename Operation>
+        constexpr void for_each_edge(const tile& window, Operation&& op) const {
+            for (std::size_t y = window.y; y < window.y + window.height; ++y) {
+                for (std::size_t x = window.x; x < window.x + window.width; ++x) {
+                    for_each_neighbor(x, y, window, [&](std::size_t nx, std::size_t ny) {
+                        if (ny > y || (ny == y && nx > x)) op(x, y, nx, ny);
+                    });
+                }
+            }
+        }
+
+        template<typename Operation>
+        constexpr void for_each_edge(Operation&& op) const { for_each_edge(whole(), op); }
+
+        // 창이 격자 안에 있는지
+        constexpr bool contains(const tile& window) const noexcept {
+            return window.x <= width_ && window.width <= width_ - window.x
+                && window.y <= height_ && window.height <= height_ - window.y;
+        }
+    };
+}
@@ -1,122 +1,206 @@
 /**
  * @file include/origami/modern_composite.hpp
  * @brief 검색 결과 [6] "값 기반 다형성" 구현
- * @details 상속 없는 현대적 Composite
+ * @details 상속 없는 현대적 Composite. 내부 복합 노드는 트리마다 하나인 node_pool 에서 할당하고,
+ *          순회와 해제는 명시적 스택으로 처리하므로 깊은 트리에서도 재귀/타입 소거 비용이 없다.
  */
 
 #pragma once
 
 #include <core/typelist.hpp>
+#include <origami/name_table.hpp>
+#include <origami/node_pool.hpp>
+#include <origami/small_buffer.hpp>
 #include <variant>
 #include <vector>
 #include <iostream>
 #include <memory>
+#include <string_view>
 
 namespace metaloki::origami {
-    
+
     /**
      * @brief 검색 결과 [6] "C++20: std::variant로 Leaf/Composite를 값 기반 다형성"
+     * @details 노드마다 자식 InlineChildren 개까지는 힙 할당 없이 노드 안에 저장한다.
+     *          복합 자식은 풀 슬롯을 가리키는 포인터로, 소유권은 트리(풀)에 있다.
      */
-    template<typename LeafValueType>
+    template<typename LeafValueType, std::size_t InlineChildren = 4>
     class modern_composite {
     private:
         // 자기 참조 타입을 위한 트릭
         struct composite_impl;
-        
+
         // 값 타입과 복합 타입을 포함하는 variant
-        using node_variant = std::variant<LeafValueType, std::unique_ptr<composite_impl>>;
-        
+        using node_variant = std::variant<LeafValueType, composite_impl*>;
+        using pool_type = node_pool<composite_impl>;
+
         // 복합 노드 구현
         struct composite_impl {
-            std::string name;
-            std::vector<node_variant> children;
-            
-            explicit composite_impl(std::string n = "Composite") : name(std::move(n)) {}
-            
-            void add_leaf(LeafValueType value) {
-                children.push_back(std::move(value));
+            small_vector<node_variant, InlineChildren> children;
+            name_id name;  // 전역 name_table 의 id
+
+            explicit composite_impl(std::string_view n = "Composite") : name(intern_name(n)) {}
+        };
+
+        // 루트 노드 (풀 밖) 와 내부 노드 풀 - node_ref 가 가리키므로 트리를 옮겨도 주소가 바뀌지 않게 힙에 둔다
+        struct tree_state {
+            composite_impl root;
+            pool_type pool;
+
+            explicit tree_state(std::string_view name) : root(name) {}
+        };
+
+        std::unique_ptr<tree_state> state_;
+
+        // 루트 아래 노드를 모두 풀로 반환 - 재귀 없이
+        void release_nodes() noexcept {
+            if (!state_) return;  // 이동된 트리
+
+            auto& root = state_->root;
+            auto& pool = state_->pool;
+            std::vector<composite_impl*> pending;
+            auto collect = [&pending](composite_impl& node) {
+                for (auto& child : node.children) {
+                    if (auto* nested = std::get_if<composite_impl*>(&child)) pending.push_back(*nested);
+                }
+            };
+
+            collect(root);
+            root.children.clear();
+            while (!pending.empty()) {
+                composite_impl* node = pending.back();
+                pending.pop_back();
+                collect(*node);
+                pool.destroy(node);
             }
-            
-            void add_composite(std::unique_ptr<composite_impl> child) {
-                children.push_back(std::move(child));
+        }
+
+    public:
+        /**
+         * @brief 트리 안 복합 노드 핸들 - 트리가 살아 있는 동안 유효
+         */
+        class node_ref {
+        private:
+            composite_impl* node_;
+            pool_type* pool_;
+
+            friend class modern_composite;
+            node_ref(composite_impl* node, pool_type* pool) noexcept : node_(node), pool_(pool) {}
+
+        public:
+            // 리프 노드 추가
+            node_ref& add_leaf(LeafValueType value) {
+                node_->children.push_back(std::move(value));
+                return *this;
             }
-            
-            // 포워딩 참조를 통한 완벽한 전달
-            template<typename... Args>
-            composite_impl& emplace_composite(Args&&... args) {
-                auto child = std::make_unique<composite_impl>(std::forward<Args>(args)...);
-                auto& ref = *child;
-                children.push_back(std::move(child));
-                return ref;
+
+            // 새 복합 노드 추가 - 새 노드의 핸들 반환
+            node_ref add_composite(std::string_view name = "Composite") {
+                composite_impl* child = pool_->create(name);
+                node_->children.push_back(child);
+                return node_ref(child, pool_);
             }
+
+            std::string_view name() const noexcept { return resolve_name(node_->name); }
+            std::size_t size() const noexcept { return node_->children.size(); }
         };
-        
-        // 루트 노드
-        composite_impl root_;
-        
-    public:
+
         // 생성자
-        explicit modern_composite(std::string name = "Root") : root_(std::move(name)) {}
-        
+        explicit modern_composite(std::string_view name = "Root") : state_(std::make_unique<tree_state>(name)) {}
+
+        modern_composite(const modern_composite&) = delete;
+        modern_composite& operator=(const modern_composite&) = delete;
+
+        // 루트와 풀은 힙 블록째 옮겨 가므로 기존 node_ref 는 새 트리의 노드를 가리킨다.
+        // 이동된 트리는 소멸이나 대입만 할 수 있다.
+        modern_composite(modern_composite&&) noexcept = default;
+
+        modern_composite& operator=(modern_composite&& other) noexcept {
+            if (this != &other) {
+                release_nodes();
+                state_ = std::move(other.state_);
+            }
+            return *this;
+        }
+
+        ~modern_composite() { release_nodes(); }
+
+        node_ref root() noexcept { return node_ref(&state_->root, &state_->pool); }
+
         // 리프 노드 추가
         void add_leaf(LeafValueType value) {
-            root_.add_leaf(std::move(value));
+            root().add_leaf(std::move(value));
         }
-        
+
         // 새 복합 노드 추가
-        modern_composite& add_composite(std::string name = "Composite") {
-            return root_.emplace_composite(std::move(name));
+        node_ref add_composite(std::string_view name = "Composite") {
+            return root().add_composite(name);
         }
-        
+
+        // 루트를 제외한 복합 노드 수
+        std::size_t composite_count() const noexcept { return state_->pool.live(); }
+
         // 검색 결과 [6] "std::visit로 render 함수 구현"
         void render() const {
-            std::cout << "Modern Composite '" << root_.name << "' {\n";
-            
-            for (const auto& child : root_.children) {
+            const composite_impl& root = state_->root;
+            std::cout << "Modern Composite '" << resolve_name(root.name) << "' {\n";
+
+            for (const auto& child : root.children) {
                 std::visit([](const auto& value) {
                     using T = std::decay_t<decltype(value)>;
-                    
+
                     if constexpr (std::is_same_v<T, LeafValueType>) {
                         if constexpr (requires { std::cout << value; }) {
                             std::cout << "  Leaf: " << value << '\n';
                         } else {
                             std::cout << "  Leaf: [value]\n";
                         }
-                    } else if constexpr (std::is_same_v<T, std::unique_ptr<composite_impl>>) {
-                        std::cout << "  Composite: '" << value->name << "' with " 
+                    } else if constexpr (std::is_same_v<T, composite_impl*>) {
+                        std::cout << "  Composite: '" << resolve_name(value->name) << "' with "
                                   << value->children.size() << " children\n";
                     }
                 }, child);
             }
-            
+
             std::cout << "}" << std::endl;
         }
-        
-        // 깊이 우선 순회
+
+        /**
+         * @brief 깊이 우선 (전위) 순회
+         * @details 연산은 템플릿으로 인라인되고 깊이마다 (cursor, end) 프레임 하나만 쌓는다.
+         *          composite_op(name, child_count) 는 복합 노드에 들어갈 때 호출된다.
+         */
         template<typename LeafOperation, typename CompositeOperation>
         void traverse_depth_first(LeafOperation&& leaf_op, CompositeOperation&& composite_op) const {
+            struct frame {
+                const node_variant* next;
+                const node_variant* end;
+            };
+
             // 루트 복합 노드에 작업 적용
-            composite_op(root_.name, root_.children.size());
-            
-            // 자식 순회 함수
-            std::function<void(const composite_impl&)> visit_composite = 
-                [&](const composite_impl& node) {
-                    for (const auto& child : node.children) {
-                        std::visit([&](const auto& value) {
-                            using T = std::decay_t<decltype(value)>;
-                            
-                            if constexpr (std::is_same_v<T, LeafValueType>) {
-                                leaf_op(value);
-                            } else if constexpr (std::is_same_v<T, std::unique_ptr<composite_impl>>) {
-                                composite_op(value->name, value->children.size());
-                                visit_composite(*value);
-                            }
-                        }, child);
+            const composite_impl& root = state_->root;
+            composite_op(resolve_name(root.name), root.children.size());
+
+            inline_stack<frame, 32> stack;
+            if (!root.children.empty()) {
+                stack.push({root.children.data(), root.children.data() + root.children.size()});
+            }
+
+            while (!stack.empty()) {
+                auto& top = stack.top();
+                const node_variant& child = *top.next++;
+                if (top.next == top.end) stack.pop();
+
+                if (const auto* nested = std::get_if<composite_impl*>(&child)) {
+                    const composite_impl& node = **nested;
+                    composite_op(resolve_name(node.name), node.children.size());
+                    if (!node.children.empty()) {
+                        stack.push({node.children.data(), node.children.data() + node.children.size()});
                     }
-                };
-            
-            // 루트부터 순회 시작
-            visit_composite(root_);
+                } else {
+                    leaf_op(*std::get_if<LeafValueType>(&child));
+                }
+            }
         }
     };
 }
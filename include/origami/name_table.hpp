@@ -0,0 +1,174 @@
+/**
+ * @file include/origami/name_table.hpp
+ * @brief composite 노드 이름 인터닝 테이블
+ * @details 노드는 std::string 대신 32비트 name_id 만 저장하고, 이름 문자열은 프로세스 전역 테이블에
+ *          한 번만 보관한다. "Row", "Cell" 처럼 반복되는 이름이 노드마다 복사되지 않으므로
+ *          노드 헤더가 작아지고 캐시 밀도가 높아진다. 문자열은 렌더링 등 필요할 때만 resolve 한다.
+ *
+ *          테이블은 커지기만 하며 한 번 반환한 string_view 는 프로세스가 끝날 때까지 유효하다.
+ *          intern 은 스레드 안전하고, resolve 는 잠금 없이 읽는다.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace metaloki::origami {
+
+    /**
+     * @brief 인터닝된 이름의 32비트 식별자
+     */
+    class name_id {
+    private:
+        std::uint32_t value_ = 0;
+
+    public:
+        constexpr name_id() noexcept = default;
+        constexpr explicit name_id(std::uint32_t value) noexcept : value_(value) {}
+
+        constexpr std::uint32_t value() const noexcept { return value_; }
+
+        friend constexpr bool operator==(name_id, name_id) noexcept = default;
+        friend constexpr auto operator<=>(name_id, name_id) noexcept = default;
+    };
+
+    /**
+     * @brief 문자열 인터닝 테이블
+     * @details 항목은 크기가 두 배씩 커지는 세그먼트에 저장되어 재할당으로 옮겨지지 않는다.
+     *          id 0 은 빈 문자열이다.
+     */
+    class name_table {
+    private:
+        static constexpr std::size_t first_segment_bits = 8;
+        static constexpr std::size_t segment_count = 32 - first_segment_bits + 1;
+        static constexpr std::size_t arena_block_size = 4096;
+
+        // 세그먼트 k 는 id [2^(b+k) - 2^b, 2^(b+k+1) - 2^b) 를 담는다 (b = first_segment_bits)
+        std::array<std::unique_ptr<std::string_view[]>, segment_count> segments_;
+        std::uint32_t size_ = 0;
+
+        // 이름 바이트 - 블록 단위로만 늘어나므로 기존 string_view 가 무효화되지 않음
+        std::vector<std::unique_ptr<char[]>> arena_;
+        std::size_t arena_used_ = arena_block_size;
+
+        struct transparent_hash {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view text) const noexcept {
+                return std::hash<std::string_view>{}(text);
+            }
+        };
+
+        std::unordered_map<std::string_view, std::uint32_t, transparent_hash, std::equal_to<>> lookup_;
+        mutable std::shared_mutex mutex_;
+
+        static constexpr std::size_t segment_of(std::uint32_t id) noexcept {
+            return static_cast<std::size_t>(std::bit_width((std::uint64_t{id} >> first_segment_bits) + 1)) - 1;
+        }
+
+        static constexpr std::uint64_t segment_base(std::size_t segment) noexcept {
+            return ((std::uint64_t{1} << segment) - 1) << first_segment_bits;
+        }
+
+        std::string_view store(std::string_view text) {
+            if (text.empty()) return {};
+            if (text.size() > arena_block_size / 4) {
+                // 긴 이름은 전용 블록 - 현재 블록이 계속 back() 에 남도록 그 앞에 끼운다
+                auto block = std::make_unique<char[]>(text.size());
+                char* bytes = block.get();
+                std::memcpy(bytes, text.data(), text.size());
+                arena_.insert(arena_.empty() ? arena_.end() : arena_.end() - 1, std::move(block));
+                return {bytes, text.size()};
+            }
+            if (arena_used_ + text.size() > arena_block_size) {
+                arena_.push_back(std::make_unique<char[]>(arena_block_size));
+                arena_used_ = 0;
+            }
+            char* bytes = arena_.back().get() + arena_used_;
+            std::memcpy(bytes, text.data(), text.size());
+            arena_used_ += text.size();
+            return {bytes, text.size()};
+        }
+
+        std::uint32_t append(std::string_view stored) {
+            if (size_ == UINT32_MAX) throw std::length_error("name_table: too many names");
+            const std::uint32_t id = size_;
+            const std::size_t segment = segment_of(id);
+            if (!segments_[segment]) {
+                segments_[segment] = std::make_unique<std::string_view[]>(std::size_t{1} << (first_segment_bits + segment));
+            }
+            segments_[segment][id - segment_base(segment)] = stored;
+            lookup_.emplace(stored, id);
+            ++size_;
+            return id;
+        }
+
+    public:
+        name_table() { append({}); }
+
+        name_table(const name_table&) = delete;
+        name_table& operator=(const name_table&) = delete;
+
+        // composite 들이 공유하는 전역 테이블
+        static name_table& global() {
+            static name_table table;
+            return table;
+        }
+
+        /**
+         * @brief 이름의 id - 처음 보는 이름이면 등록
+         */
+        name_id intern(std::string_view text) {
+            {
+                std::shared_lock lock(mutex_);
+                if (auto found = lookup_.find(text); found != lookup_.end()) return name_id(found->second);
+            }
+
+            std::unique_lock lock(mutex_);
+            if (auto found = lookup_.find(text); found != lookup_.end()) return name_id(found->second);
+            return name_id(append(store(text)));
+        }
+
+        /**
+         * @brief id 의 이름 - id 는 이 테이블의 intern 이 반환한 값이어야 한다
+         * @details id 를 얻은 시점에 항목은 이미 기록되어 있으므로 잠금이 필요 없다
+         */
+        std::string_view resolve(name_id id) const noexcept {
+            const std::size_t segment = segment_of(id.value());
+            return segments_[segment][id.value() - segment_base(segment)];
+        }
+
+        std::size_t size() const {
+            std::shared_lock lock(mutex_);
+            return size_;
+        }
+    };
+
+    /**
+     * @brief 전역 테이블에 이름 등록 - 같은 스레드에서 직전과 같은 이름이면 테이블을 거치지 않음
+     */
+    inline name_id intern_name(std::string_view text) {
+        thread_local std::string_view last_name;
+        thread_local name_id last_id;
+
+        if (text == last_name) return last_id;  // 초기값은 빈 이름 = id 0
+
+        last_id = name_table::global().intern(text);
+        last_name = name_table::global().resolve(last_id);
+        return last_id;
+    }
+
+    inline std::string_view resolve_name(name_id id) noexcept {
+        return name_table::global().resolve(id);
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * @file include/origami/node_pool.hpp
+ * @brief 트리 노드용 고정 크기 슬랩 할당기
+ * @details 노드마다 new/delete 를 부르는 대신 블록 단위로 확보한 슬롯을 나눠 주고,
+ *          해제된 슬롯은 free list 로 재사용한다. 블록 주소는 풀이 이동해도 바뀌지 않으므로
+ *          노드 포인터는 풀(또는 그 풀을 가진 트리)이 이동해도 유효하다.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace metaloki::origami {
+
+    /**
+     * @brief T 전용 슬랩 풀
+     * @details 풀이 소멸할 때 살아 있는 객체의 소멸자는 호출하지 않는다 - 소유자가 먼저 destroy 해야 한다.
+     */
+    template<typename T, std::size_t BlockNodes = 64>
+    class node_pool {
+        static_assert(BlockNodes > 0, "Block size must be positive");
+
+    private:
+        union slot {
+            slot* next;
+            alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        std::vector<std::unique_ptr<slot[]>> blocks_;
+        slot* free_ = nullptr;                 // 해제된 슬롯 목록
+        std::size_t next_in_block_ = BlockNodes;  // 마지막 블록에서 아직 쓰지 않은 첫 슬롯
+        std::size_t live_ = 0;
+
+        slot* acquire() {
+            if (free_) return std::exchange(free_, free_->next);
+            if (next_in_block_ == BlockNodes) {
+                blocks_.push_back(std::make_unique_for_overwrite<slot[]>(BlockNodes));
+                next_in_block_ = 0;
+            }
+            return &blocks_.back()[next_in_block_++];
+        }
+
+    public:
+        node_pool() = default;
+
+        node_pool(const node_pool&) = delete;
+        node_pool& operator=(const node_pool&) = delete;
+
+        node_pool(node_pool&& other) noexcept
+            : blocks_(std::move(other.blocks_)),
+              free_(std::exchange(other.free_, nullptr)),
+              next_in_block_(std::exchange(other.next_in_block_, BlockNodes)),
+              live_(std::exchange(other.live_, 0)) {}
+
+        node_pool& operator=(node_pool&& other) noexcept {
+            blocks_ = std::move(other.blocks_);
+            free_ = std::exchange(other.free_, nullptr);
+            next_in_block_ = std::exchange(other.next_in_block_, BlockNodes);
+            live_ = std::exchange(other.live_, 0);
+            return *this;
+        }
+
+        template<typename... Args>
+        T* create(Args&&... args) {
+            slot* target = acquire();
+            try {
+                T* object = ::new (static_cast<void*>(target->storage)) T(std::forward<Args>(args)...);
+                ++live_;
+                return object;
+            } catch (...) {
+                target->next = free_;
+                free_ = target;
+                throw;
+            }
+        }
+
+        void destroy(T* object) noexcept {
+            object->~T();
+            slot* released = reinterpret_cast<slot*>(object);
+            released->next = free_;
+            free_ = released;
+            --live_;
+        }
+
+        // 살아 있는 객체 수 / 확보한 슬롯 수
+        std::size_t live() const noexcept { return live_; }
+        std::size_t capacity() const noexcept { return blocks_.size() * BlockNodes; }
+    };
+}
@@ -1,84 +1,231 @@
 /**
  * @file include/origami/optimized_patterns.hpp
  * @brief ORIGAMI 패턴 성능 최적화 버전
+ * @details composite 는 자식을 variant 배열 하나에 담으므로 순회마다 타입 분기가 필요하다.
+ *          여기의 fast_composite 는 자식을 타입별 연속 배열(파티션)에 나눠 담아
+ *          파티션마다 단일 타입 루프를 돌게 하므로, 분기 없이 인라인되고 자동 벡터화된다.
+ *          대신 서로 다른 타입 사이의 삽입 순서는 보존하지 않는다 (같은 타입 안에서는 보존).
  */
 
 #pragma once
 
 #include <origami/composite.hpp>
-#include <origami/iterator.hpp>
-#include <origami/visitor.hpp>
-#include <origami/builder.hpp>
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace metaloki::origami::optimized {
+
+    namespace detail {
+        using origami::detail::default_inline_children;
+
+        template<typename T, typename... Types>
+        inline constexpr std::size_t count_of = (std::size_t{std::is_same_v<T, Types>} + ... + 0);
+    }
 
-namespace origami::optimized {
-    
     /**
-     * @brief 성능 최적화된 Composite - 메모리 레이아웃 최적화
+     * @brief 타입 분할 저장소를 쓰는 Composite - 자식 타입마다 vector 하나
+     * @details 자식 타입은 서로 달라야 한다. 이름은 composite 와 같이 name_id 로 보관한다.
      */
     template<typename... ComponentTypes>
-    class fast_composite : public composite<ComponentTypes...> {
-        using base = composite<ComponentTypes...>;
-        
-        // 캐시 친화적 메모리 레이아웃
-        static constexpr size_t cache_line_size = 64;
-        alignas(cache_line_size) typename base::child_list optimized_children_;
-        
+    class fast_composite {
+        static_assert(sizeof...(ComponentTypes) > 0, "fast_composite needs at least one child type");
+        static_assert(((detail::count_of<ComponentTypes, ComponentTypes...> == 1) && ...),
+            "Child types of fast_composite must be distinct");
+
+    private:
+        std::tuple<std::vector<ComponentTypes>...> partitions_;
+        name_id name_;
+
+        template<typename T>
+        static constexpr bool is_child_type = (std::is_same_v<T, ComponentTypes> || ...);
+
+        template<typename T>
+        void reserve_more(std::size_t incoming) {
+            auto& target = std::get<std::vector<T>>(partitions_);
+            if (incoming > 0) target.reserve(target.size() + incoming);
+        }
+
     public:
-        using base::base;
-        
-        // 벌크 추가 최적화
+        explicit fast_composite(std::string_view name = "Fast Composite") : name_(intern_name(name)) {}
+
+        /**
+         * @brief composite 의 (직계) 자식을 타입별로 복사해 생성
+         * @details 자식 타입 목록이 같아야 하며, 타입별 개수를 먼저 세어 파티션마다 한 번만 할당한다
+         */
+        template<std::size_t N>
+        static fast_composite from(const basic_composite<N, ComponentTypes...>& source) {
+            fast_composite result(source.name());
+            const auto& children = source.children();
+
+            std::size_t counts[sizeof...(ComponentTypes)] = {};
+            for (const auto& child : children) ++counts[child.index()];
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (std::get<I>(result.partitions_).reserve(counts[I]), ...);
+            }(std::index_sequence_for<ComponentTypes...>{});
+
+            for (const auto& child : children) {
+                std::visit([&result](const auto& element) { result.add(element); }, child);
+            }
+            return result;
+        }
+
+        std::string_view name() const { return resolve_name(name_); }
+        void set_name(std::string_view name) { name_ = intern_name(name); }
+
+        // 자식 추가 - 타입에 맞는 파티션 끝에
+        template<typename Element>
+            requires is_child_type<std::decay_t<Element>>
+        void add(Element&& element) {
+            partition<std::decay_t<Element>>().push_back(std::forward<Element>(element));
+        }
+
+        template<typename T, typename... Args>
+            requires is_child_type<T>
+        T& emplace(Args&&... args) {
+            return partition<T>().emplace_back(std::forward<Args>(args)...);
+        }
+
+        // 벌크 추가 최적화 - 파티션마다 한 번만 재할당
         template<typename... Elements>
         void add_bulk(Elements&&... elements) {
-            optimized_children_.reserve(optimized_children_.size() + sizeof...(elements));
-            (optimized_children_.push_back(std::forward<Elements>(elements)), ...);
+            (reserve_more<ComponentTypes>(detail::count_of<ComponentTypes, std::decay_t<Elements>...>), ...);
+            (add(std::forward<Elements>(elements)), ...);
         }
-        
-        // 메모리 사전 할당
-        void reserve_capacity(size_t capacity) {
-            optimized_children_.reserve(capacity);
+
+        // 같은 타입 요소 구간 추가 - 크기를 아는 구간이면 재할당은 한 번
+        template<std::ranges::input_range Range>
+            requires is_child_type<std::ranges::range_value_t<Range>>
+        void append_range(Range&& range) {
+            auto& target = partition<std::ranges::range_value_t<Range>>();
+            if constexpr (std::ranges::sized_range<Range>) {
+                target.reserve(target.size() + std::ranges::size(range));
+            }
+            if constexpr (!std::is_lvalue_reference_v<Range> && !std::ranges::view<std::remove_cvref_t<Range>>) {
+                for (auto& element : range) target.push_back(std::move(element));
+            } else {
+                for (auto&& element : range) target.push_back(element);
+            }
         }
-        
-        // 이동 의미론 최적화
-        template<typename Element>
-        void add_move(Element&& element) {
-            optimized_children_.push_back(std::move(element));
+
+        // 메모리 사전 할당 - T 파티션 또는 모든 파티션
+        template<typename T>
+            requires is_child_type<T>
+        void reserve(std::size_t capacity) { partition<T>().reserve(capacity); }
+
+        void reserve_capacity(std::size_t capacity) {
+            std::apply([capacity](auto&... partition) { (partition.reserve(capacity), ...); }, partitions_);
+        }
+
+        // 파티션 직접 접근 - 연속 메모리
+        template<typename T>
+            requires is_child_type<T>
+        std::vector<T>& partition() { return std::get<std::vector<T>>(partitions_); }
+
+        template<typename T>
+            requires is_child_type<T>
+        const std::vector<T>& partition() const { return std::get<std::vector<T>>(partitions_); }
+
+        template<typename T>
+            requires is_child_type<T>
+        std::span<const T> children_of() const { return partition<T>(); }
+
+        std::size_t size() const noexcept {
+            return std::apply([](const auto&... partition) { return (partition.size() + ...); }, partitions_);
+        }
+
+        template<typename T>
+            requires is_child_type<T>
+        std::size_t size() const noexcept { return partition<T>().size(); }
+
+        bool empty() const noexcept { return size() == 0; }
+
+        void clear() noexcept {
+            std::apply([](auto&... partition) { (partition.clear(), ...); }, partitions_);
+        }
+
+        /**
+         * @brief 모든 자식에 op(element) - 파티션 순서대로, 파티션마다 단일 타입 루프
+         */
+        template<typename Operation>
+        void for_each(Operation&& op) const {
+            std::apply([&op](const auto&... partition) {
+                ([&op](const auto& elements) {
+                    for (const auto& element : elements) op(element);
+                }(partition), ...);
+            }, partitions_);
+        }
+
+        template<typename Operation>
+        void for_each(Operation&& op) {
+            std::apply([&op](auto&... partition) {
+                ([&op](auto& elements) {
+                    for (auto& element : elements) op(element);
+                }(partition), ...);
+            }, partitions_);
+        }
+
+        // 직계 자식을 composite 로 변환 - 타입 파티션 순서로 배치된다
+        template<std::size_t N = detail::default_inline_children<ComponentTypes...>>
+            requires (Component<ComponentTypes> && ...)
+        basic_composite<N, ComponentTypes...> to_composite() const {
+            basic_composite<N, ComponentTypes...> result(name_);
+            result.reserve(size());
+            for_each([&result](const auto& element) { result.add_copy(element); });
+            return result;
         }
     };
-    
+
     /**
-     * @brief 성능 최적화된 Iterator - 분기 예측 최적화
+     * @brief 성능 최적화된 Iterator - 파티션별 단일 타입 루프
+     * @details 요소마다 std::visit 을 거치지 않으므로 op 가 인라인되고 산술 루프는 벡터화된다
      */
     template<typename... ComponentTypes>
     class fast_iterator {
         using composite_type = fast_composite<ComponentTypes...>;
-        
-        // 분기 예측 힌트
-        static constexpr bool likely_has_children = true;
-        
+
     public:
         template<typename Operation>
-        void fast_for_each(const composite_type& composite, Operation&& op) {
-            const auto& children = composite.children();
-            
-            // 벡터화 가능한 루프
-            for (size_t i = 0; i < children.size(); ++i) {
-                [[likely]] if constexpr (likely_has_children) {
-                    std::visit([&op](const auto& element) {
-                        op(element);
-                    }, children[i]);
-                }
+        void fast_for_each(const composite_type& composite, Operation&& op) const {
+            composite.for_each(std::forward<Operation>(op));
+        }
+
+        // T 파티션만 순회
+        template<typename T, typename Operation>
+        void fast_for_each_of(const composite_type& composite, Operation&& op) const {
+            for (const T& element : composite.template partition<T>()) op(element);
+        }
+
+        /**
+         * @brief T 파티션의 projection(element) 을 reduce(acc, value) 로 접는다
+         * @details 결합 순서 재배치를 허용하는 정수/비교 연산이면 컴파일러가 SIMD 루프로 바꾼다
+         */
+        template<typename T, typename Result, typename Reduce, typename Projection>
+        Result fast_reduce(const composite_type& composite, Result init, Reduce reduce, Projection projection) const {
+            const auto& elements = composite.template partition<T>();
+            const T* data = elements.data();
+            const std::size_t count = elements.size();
+            for (std::size_t i = 0; i < count; ++i) {
+                init = reduce(init, static_cast<Result>(projection(data[i])));
             }
+            return init;
         }
     };
-    
+
     /**
-     * @brief 성능 최적화된 Visitor - 가상 함수 제거
+     * @brief 성능 최적화된 Visitor - 가상 함수와 타입 소거 없음
+     * @details value() 를 가진 자식 타입의 값을 ResultType 으로 합산한다.
+     *          어떤 타입을 방문할지는 컴파일 타임에 정해지므로 런타임 디스패치가 없다.
      */
     template<typename ResultType = void>
     class fast_visitor {
-        // 함수 포인터 대신 std::function 최적화
-        using visitor_func = std::function<ResultType(const auto&)>;
-        
     public:
         template<typename Element>
         constexpr ResultType visit(const Element& element) {
@@ -89,23 +236,41 @@ namespace origami::optimized {
                 return process_element(element);
             }
         }
-        
+
+        // 파티션마다 합산 - 값이 없는 타입의 파티션은 통째로 건너뛴다
+        template<typename... ComponentTypes>
+            requires (!std::is_void_v<ResultType>)
+        ResultType visit(const fast_composite<ComponentTypes...>& composite) {
+            ResultType total{};
+            ([&]<typename T>(std::type_identity<T>) {
+                if constexpr (has_value<T>) {
+                    for (const T& element : composite.template partition<T>()) {
+                        total += static_cast<ResultType>(element.value());
+                    }
+                }
+            }(std::type_identity<ComponentTypes>{}), ...);
+            return total;
+        }
+
     private:
+        template<typename Element>
+        static constexpr bool has_value = requires(const Element& element) {
+            static_cast<ResultType>(element.value());
+        };
+
         template<typename Element>
         constexpr ResultType process_element(const Element& element) {
             // 타입별 특화 처리 (컴파일 타임 분기)
-            if constexpr (requires { element.value(); }) {
-                if constexpr (!std::is_void_v<ResultType>) {
+            if constexpr (!std::is_void_v<ResultType>) {
+                if constexpr (has_value<Element>) {
                     return static_cast<ResultType>(element.value());
+                } else {
+                    return ResultType{};
                 }
             }
-            
-            if constexpr (!std::is_void_v<ResultType>) {
-                return ResultType{};
-            }
         }
     };
-    
+
     /**
      * @brief 성능 최적화된 Builder - RAII 및 이동 의미론
      */
@@ -114,20 +279,19 @@ namespace origami::optimized {
     private:
         std::unique_ptr<fast_composite<ComponentTypes...>> result_;
         bool finalized_ = false;
-        
+
     public:
-        fast_builder() : result_(std::make_unique<fast_composite<ComponentTypes...>>("Fast Built")) {
-            result_->reserve_capacity(16); // 기본 용량 사전 할당
-        }
-        
+        explicit fast_builder(std::string_view name = "Fast Built")
+            : result_(std::make_unique<fast_composite<ComponentTypes...>>(name)) {}
+
         // 이동 체이닝
         fast_builder&& add(auto&& element) && {
             if (!finalized_) {
-                result_->add_move(std::forward<decltype(element)>(element));
+                result_->add(std::forward<decltype(element)>(element));
             }
             return std::move(*this);
         }
-        
+
         // 벌크 추가 최적화
         template<typename... Elements>
         fast_builder&& add_all(Elements&&... elements) && {
@@ -136,7 +300,16 @@ namespace origami::optimized {
             }
             return std::move(*this);
         }
-        
+
+        // 같은 타입 요소 구간 추가
+        template<std::ranges::input_range Range>
+        fast_builder&& add_range(Range&& range) && {
+            if (!finalized_) {
+                result_->append_range(std::forward<Range>(range));
+            }
+            return std::move(*this);
+        }
+
         // RAII 기반 자동 완료
         std::unique_ptr<fast_composite<ComponentTypes...>> finish() && {
             finalized_ = true;
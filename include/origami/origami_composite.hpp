@@ -7,11 +7,46 @@
 #pragma once
 
 #include <origami/composite.hpp>
+#include <origami/cow_array.hpp>
+#include <origami/graph_algorithms.hpp>
+#include <origami/miura_lattice.hpp>
 #include <core/policy_host.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace metaloki::origami {
     
+    /**
+     * @brief origami_composite 연결 저장 방식
+     * @details directed: connect(a, b) 는 a -> b 하나 (기본)
+     *          undirected: 접힘선을 번호가 작은 끝에 한 번만 저장하고 양 끝에서 방문한다.
+     *          저장 항목은 절반이지만 양방향 방문에 쓰는 역방향 색인(접힘선당 4 바이트 + 노드당 8 바이트)이
+     *          첫 방문 때 생기고 스냅샷도 이를 붙잡으므로, 상주 메모리 절감은 그만큼 작다 (edge_memory).
+     */
+    enum class edge_mode {
+        directed,
+        undirected
+    };
+    
+    struct edge_options {
+        edge_mode mode = edge_mode::directed;
+        // 노드별 연결 목록을 정렬해 두고 이미 있는 연결은 거부 (이진 탐색)
+        bool unique = false;
+    };
+    
     /**
      * @brief 검색 결과 [1] "origami cores" 구현
      * @details Policy 기반 Origami Composite
@@ -34,14 +69,348 @@ namespace metaloki::origami {
             explicit node(ElementType e) : element(std::move(e)) {}
         };
         
-        std::vector<node> nodes_;
+        // 4KB 청크 단위 copy-on-write 저장소 - 스냅샷과 공유 중인 청크만 쓰기 시 복사
+        using node_array = detail::cow_chunked_array<node>;
+        
+        /**
+         * @brief 연결을 저장하지 않고 좌표로 계산하는 노드 구간 [base, base + lattice.node_count())
+         * @details 이 구간 노드의 connections 에는 격자에 없는 추가 연결(불규칙 보정)만 들어간다
+         */
+        struct implicit_region {
+            miura_lattice lattice;
+            size_t base = 0;
+            
+            bool contains(size_t index) const noexcept { return index - base < lattice.node_count(); }
+            
+            // 두 노드가 격자 이웃인지
+            bool adjacent(size_t from, size_t to) const noexcept {
+                if (!contains(from) || !contains(to)) return false;
+                bool found = false;
+                lattice.for_each_neighbor(from - base, [&](size_t neighbor) { found |= base + neighbor == to; });
+                return found;
+            }
+        };
+        
+        /**
+         * @brief undirected 모드의 역방향 색인 - 노드 v 보다 작은 번호 쪽에 저장된 접힘선의 반대 끝
+         * @details CSR(노드당 8 바이트 offsets + 접힘선당 4 바이트 sources)이라 저장 연결(접힘선당 8 바이트)의
+         *          절반 크기지만, 만들어진 뒤에는 패턴과 스냅샷이 계속 들고 있다. 색인 이후 connect 한
+         *          접힘선은 (노드, 반대 끝) 순으로 정렬된 recent 에 끼워 넣고, 방문할 때 CSR 과 병합해
+         *          새로 만든 색인과 같은 순서로 내놓는다. recent 가 CSR 크기의 제곱근을 넘으면 버리고
+         *          다음 방문 때 다시 만든다 - 연결과 방문을 번갈아도 연결당 비용은 제곱근 수준이다.
+         *          색인 이후 추가된 노드는 CSR 범위 밖이어도 된다.
+         */
+        struct lower_index {
+            std::vector<size_t> offsets;
+            std::vector<std::uint32_t> sources;
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> recent;
+            
+            size_t recent_limit() const noexcept {
+                return std::max<size_t>(64, size_t{1} << (std::bit_width(offsets.size() + sources.size()) / 2));
+            }
+        };
+        
+        /**
+         * @brief 접힘선 번호 - 작은 쪽 끝에서 처음 나온 순서 (crease_graph 와 같은 번호)
+         * @details undirected 모드는 first[v] 가 v 가 소유한(작은 쪽 끝인) 첫 접힘선 번호다.
+         *          directed 모드는 접힘선 하나가 방향 연결 두 개이므로 first[v] 는 v 의 첫 연결 위치이고,
+         *          ids 가 연결 위치마다 graph::detail::pair_mirrors 로 짝지은 번호를 준다.
+         *          스냅샷과 공유하고 번호가 처음 필요할 때 한 번만 채운다. 연결이 바뀌면 패턴 쪽은 버린다.
+         *          번호를 채운 뒤 추가된 노드는 아직 연결이 없으므로 범위 밖이어도 된다.
+         */
+        struct edge_numbering {
+            bool undirected = false;
+            std::once_flag built;
+            std::vector<size_t> first;
+            std::vector<size_t> ids;
+            
+            size_t first_edge(size_t node_index) const noexcept {
+                return node_index < first.size() ? first[node_index] : first.back();
+            }
+        };
+        
+        node_array nodes_;
         std::string pattern_name_;
+        std::optional<implicit_region> implicit_;
+        edge_options edge_options_;
+        mutable std::shared_ptr<lower_index> lower_;
+        mutable std::shared_ptr<edge_numbering> numbering_;
+        
+        static std::shared_ptr<lower_index> build_lower_index(const node_array& nodes) {
+            const size_t count = nodes.size();
+            if (count >= std::numeric_limits<std::uint32_t>::max()) {
+                throw std::length_error("Undirected patterns support fewer than 2^32 - 1 nodes");
+            }
+            
+            auto index = std::make_shared<lower_index>();
+            index->offsets.assign(count + 1, 0);
+            for (size_t i = 0; i < count; ++i) {
+                for (size_t connected : nodes[i].connections) {
+                    if (connected != i) ++index->offsets[connected + 1];
+                }
+            }
+            for (size_t i = 0; i < count; ++i) index->offsets[i + 1] += index->offsets[i];
+            
+            index->sources.resize(index->offsets.back());
+            std::vector<size_t> cursor(index->offsets.begin(), index->offsets.end() - 1);
+            for (size_t i = 0; i < count; ++i) {
+                for (size_t connected : nodes[i].connections) {
+                    if (connected != i) index->sources[cursor[connected]++] = static_cast<std::uint32_t>(i);
+                }
+            }
+            return index;
+        }
+        
+        // 잠금을 쥔 상태에서 호출 - directed 모드는 nullptr
+        const lower_index* lower_connections() const {
+            if (edge_options_.mode != edge_mode::undirected) return nullptr;
+            if (!lower_) lower_ = build_lower_index(nodes_);
+            return lower_.get();
+        }
+        
+        // 잠금을 쥔 상태에서 호출 - 색인이 있으면 from < to 접힘선을 recent 에 반영
+        void add_lower_connection(size_t from, size_t to) {
+            if (!lower_) return;
+            if (lower_->recent.size() >= lower_->recent_limit() || to >= std::numeric_limits<std::uint32_t>::max()) {
+                lower_.reset();
+                return;
+            }
+            if (lower_.use_count() != 1) {
+                lower_ = std::make_shared<lower_index>(*lower_);  // 스냅샷과 공유 중
+            } else {
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            
+            auto& recent = lower_->recent;
+            const std::pair entry{static_cast<std::uint32_t>(to), static_cast<std::uint32_t>(from)};
+            recent.insert(std::upper_bound(recent.begin(), recent.end(), entry), entry);
+        }
+        
+        // 역방향 색인의 node_index 몫 - CSR 구간과 recent 구간을 반대 끝 번호 순으로 병합해 op(source)
+        template<typename Operation>
+        static void for_each_lower(const lower_index& lower, size_t node_index, Operation&& op) {
+            size_t k = 0;
+            size_t end = 0;
+            if (node_index + 1 < lower.offsets.size()) {
+                k = lower.offsets[node_index];
+                end = lower.offsets[node_index + 1];
+            }
+            const auto by_node = [](const auto& entry, size_t value) { return entry.first < value; };
+            auto recent = std::lower_bound(lower.recent.begin(), lower.recent.end(), node_index, by_node);
+            while (k < end || (recent != lower.recent.end() && recent->first == node_index)) {
+                if (k < end && (recent == lower.recent.end() || recent->first != node_index
+                                || lower.sources[k] <= recent->second)) {
+                    op(static_cast<size_t>(lower.sources[k++]));
+                } else {
+                    op(static_cast<size_t>((recent++)->second));
+                }
+            }
+        }
+        
+        // 격자 연결, 역방향 색인, 저장된 연결 순으로 func(from, to, from_element, to_element)
+        template<typename Nodes, typename Function>
+        static void visit_node_connections(const Nodes& nodes, const std::optional<implicit_region>& implicit,
+                                           const lower_index* lower, size_t node_index, Function& func) {
+            const node& source = nodes[node_index];
+            if (implicit && implicit->contains(node_index)) {
+                const size_t base = implicit->base;
+                implicit->lattice.for_each_neighbor(node_index - base, [&](size_t neighbor) {
+                    func(node_index, base + neighbor, source.element, nodes[base + neighbor].element);
+                });
+            }
+            if (lower) {
+                for_each_lower(*lower, node_index, [&](size_t connected) {
+                    func(node_index, connected, source.element, nodes[connected].element);
+                });
+            }
+            for (size_t connected : source.connections) {
+                func(node_index, connected, source.element, nodes[connected].element);
+            }
+        }
+        
+        // node_index 가 소유한 격자 접힘선 수 - undirected 모드는 뒤쪽 이웃만
+        static size_t owned_lattice_edges(const std::optional<implicit_region>& implicit, bool undirected,
+                                          size_t node_index) {
+            if (!implicit || !implicit->contains(node_index)) return 0;
+            const size_t local = node_index - implicit->base;
+            size_t count = 0;
+            implicit->lattice.for_each_neighbor(local, [&](size_t neighbor) { count += !undirected || neighbor > local; });
+            return count;
+        }
+        
+        template<typename Nodes>
+        static const edge_numbering& fill_edge_numbering(edge_numbering& numbering, const Nodes& nodes,
+                                                         const std::optional<implicit_region>& implicit) {
+            std::call_once(numbering.built, [&] {
+                numbering.first.resize(nodes.size() + 1);
+                size_t next = 0;
+                for (size_t i = 0; i < nodes.size(); ++i) {
+                    numbering.first[i] = next;
+                    next += owned_lattice_edges(implicit, numbering.undirected, i) + nodes[i].connections.size();
+                }
+                numbering.first.back() = next;
+                if (numbering.undirected) return;
+                
+                // directed - 방문 순서대로 연결 대상을 모아 역방향 연결과 짝짓는다
+                std::vector<size_t> targets;
+                targets.reserve(next);
+                for (size_t i = 0; i < nodes.size(); ++i) {
+                    if (implicit && implicit->contains(i)) {
+                        implicit->lattice.for_each_neighbor(i - implicit->base, [&](size_t neighbor) {
+                            targets.push_back(implicit->base + neighbor);
+                        });
+                    }
+                    targets.insert(targets.end(), nodes[i].connections.begin(), nodes[i].connections.end());
+                }
+                graph::detail::pair_mirrors(std::span<const size_t>(numbering.first),
+                                            std::span<const size_t>(targets), numbering.ids);
+            });
+            return numbering;
+        }
+        
+        // 잠금을 쥔 상태에서 호출 - 스냅샷에 넘길 번호 (아직 채우지 않았을 수 있다)
+        std::shared_ptr<edge_numbering> shared_numbering() const {
+            if (!numbering_) {
+                numbering_ = std::make_shared<edge_numbering>();
+                numbering_->undirected = is_undirected();
+            }
+            return numbering_;
+        }
+        
+        // connections 에서 occurrence 번째 target 의 위치
+        static size_t stored_position(const std::vector<size_t>& connections, size_t target, size_t occurrence) noexcept {
+            for (size_t i = 0; i < connections.size(); ++i) {
+                if (connections[i] == target && occurrence-- == 0) return i;
+            }
+            return connections.size();  // 역방향 색인과 연결 목록이 어긋나지 않는 한 도달하지 않음
+        }
+        
+        /**
+         * @brief visit_node_connections 와 같은 순서로 func(from, to, edge_id)
+         * @details 소유한 접힘선은 first_edge 부터 방문 순서대로, 반대 끝이 소유한 접힘선은 그 노드의
+         *          소유 목록에서 위치를 찾아 번호를 정한다. 같은 노드 쌍의 중복 연결은 k 번째끼리 짝짓는다.
+         */
+        template<typename Nodes, typename Function>
+        static void visit_node_edges(const Nodes& nodes, const std::optional<implicit_region>& implicit,
+                                     const lower_index* lower, const edge_numbering& numbering,
+                                     size_t node_index, Function& func) {
+            if (!numbering.undirected) {
+                // directed - 연결 위치마다 짝지은 번호
+                size_t slot = numbering.first_edge(node_index);
+                auto numbered = [&](size_t from, size_t to, const ElementType&, const ElementType&) {
+                    func(from, to, numbering.ids[slot++]);
+                };
+                visit_node_connections(nodes, implicit, nullptr, node_index, numbered);
+                return;
+            }
+            
+            const size_t own = numbering.first_edge(node_index);
+            size_t owned = 0;
+            if (implicit && implicit->contains(node_index)) {
+                const size_t base = implicit->base;
+                const size_t local = node_index - base;
+                implicit->lattice.for_each_neighbor(local, [&](size_t neighbor) {
+                    if (neighbor > local) {
+                        func(node_index, base + neighbor, own + owned++);
+                        return;
+                    }
+                    // 앞쪽 이웃이 소유 - 그 노드의 뒤쪽 이웃 중 몇 번째인지
+                    size_t position = 0;
+                    bool found = false;
+                    implicit->lattice.for_each_neighbor(neighbor, [&](size_t other) {
+                        if (found) return;
+                        if (other == local) {
+                            found = true;
+                        } else if (other > neighbor) {
+                            ++position;
+                        }
+                    });
+                    func(node_index, base + neighbor, numbering.first_edge(base + neighbor) + position);
+                });
+            }
+            if (lower) {
+                size_t previous = node_index;
+                size_t occurrence = 0;
+                for_each_lower(*lower, node_index, [&](size_t connected) {
+                    occurrence = connected == previous ? occurrence + 1 : 0;
+                    previous = connected;
+                    const size_t position = owned_lattice_edges(implicit, true, connected)
+                        + stored_position(nodes[connected].connections, node_index, occurrence);
+                    func(node_index, connected, numbering.first_edge(connected) + position);
+                });
+            }
+            for (size_t connected : nodes[node_index].connections) {
+                func(node_index, connected, own + owned++);
+            }
+        }
         
     public:
+        /**
+         * @brief 특정 시점의 노드/연결 배열을 고정한 불변 버전
+         * @details 쓰기 쪽 청크를 공유하므로 생성 비용은 청크 수에 비례하고, 이후 쓰기 쪽은
+         *          건드린 청크만 복사한다. 락 없이 읽으므로 여러 분석 스레드가 동시에 사용해도
+         *          편집 중인 쓰기 스레드를 막지 않는다.
+         */
+        class snapshot {
+        private:
+            friend class origami_composite;
+            
+            typename node_array::frozen nodes_;
+            std::string pattern_name_;
+            std::optional<implicit_region> implicit_;
+            std::shared_ptr<const lower_index> lower_;
+            std::shared_ptr<edge_numbering> numbering_;
+            
+            snapshot(typename node_array::frozen nodes, std::string pattern_name, std::optional<implicit_region> implicit,
+                     std::shared_ptr<const lower_index> lower, std::shared_ptr<edge_numbering> numbering)
+                : nodes_(std::move(nodes)), pattern_name_(std::move(pattern_name)), implicit_(implicit),
+                  lower_(std::move(lower)), numbering_(std::move(numbering)) {}
+            
+        public:
+            snapshot() = default;
+            
+            std::size_t size() const noexcept { return nodes_.size(); }
+            const std::string& pattern_name() const noexcept { return pattern_name_; }
+            
+            const ElementType& get_element(size_t index) const {
+                ValidationPolicy::assert_that(index < nodes_.size(), "Invalid node index");
+                return nodes_[index].element;
+            }
+            
+            template<typename Operation>
+            void traverse(Operation&& op) const {
+                nodes_.for_each_chunk([&op](const node* first, const node* last, size_t base) {
+                    for (const node* current = first; current != last; ++current) {
+                        op(base + static_cast<size_t>(current - first), current->element);
+                    }
+                });
+            }
+            
+            template<typename Function>
+            void visit_connections(size_t node_index, Function&& func) const {
+                ValidationPolicy::assert_that(node_index < nodes_.size(), "Invalid node index");
+                visit_node_connections(nodes_, implicit_, lower_.get(), node_index, func);
+            }
+            
+            // origami_composite::visit_connection_ids 와 같다 - 번호는 처음 쓸 때 한 번 매긴다
+            template<typename Function>
+            void visit_connection_ids(size_t node_index, Function&& func) const {
+                ValidationPolicy::assert_that(node_index < nodes_.size(), "Invalid node index");
+                const auto& numbering = fill_edge_numbering(*numbering_, nodes_, implicit_);
+                visit_node_edges(nodes_, implicit_, lower_.get(), numbering, node_index, func);
+            }
+        };
+        
         // 생성자
         explicit origami_composite(std::string pattern_name = "Miura-ori") 
             : pattern_name_(std::move(pattern_name)) {}
         
+        origami_composite(std::string pattern_name, edge_options options)
+            : pattern_name_(std::move(pattern_name)), edge_options_(options) {}
+        
+        const edge_options& edge_settings() const noexcept { return edge_options_; }
+        bool is_undirected() const noexcept { return edge_options_.mode == edge_mode::undirected; }
+        
         // 요소 추가
         template<typename... Args>
         size_t add_element(Args&&... args) {
@@ -54,8 +423,12 @@ namespace metaloki::origami {
             return index;
         }
         
-        // 연결 추가 (검색 결과 [1] "crease lines")
-        void connect(size_t from, size_t to) {
+        /**
+         * @brief 연결 추가 (검색 결과 [1] "crease lines") - 추가했으면 true
+         * @details undirected 모드에서는 connect(a, b) 하나로 양 끝에서 방문되며 작은 번호 쪽에 저장된다.
+         *          unique 설정이면 격자 이웃이거나 이미 저장된 연결은 false 를 반환하고 무시한다.
+         */
+        bool connect(size_t from, size_t to) {
             auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
             
             this->template get_policy<ValidationPolicy>().assert_that(
@@ -63,52 +436,203 @@ namespace metaloki::origami {
                 "Invalid node indices"
             );
             
-            nodes_[from].connections.push_back(to);
+            if (is_undirected() && to < from) std::swap(from, to);
+            auto& connections = nodes_.mutable_at(from).connections;
+            if (edge_options_.unique) {
+                if (implicit_ && implicit_->adjacent(from, to)) return false;
+                const auto position = std::lower_bound(connections.begin(), connections.end(), to);
+                if (position != connections.end() && *position == to) return false;
+                connections.insert(position, to);
+            } else {
+                connections.push_back(to);
+            }
+            if (is_undirected() && from != to) add_lower_connection(from, to);
+            numbering_.reset();
+            return true;
         }
         
         // 검색 결과 [1] "Miura-derivative prismatic base patterns"
         void create_miura_pattern(size_t width, size_t height) {
-            // Miura-ori 패턴 생성 - 기본 격자 구조
-            std::vector<size_t> indices;
-            indices.reserve(width * height);
+            const miura_lattice lattice(width, height);
+            create_miura_tile(lattice, lattice.whole());
+        }
+        
+        /**
+         * @brief 격자의 창 하나만 노드/연결로 만든다 - 반환값은 창의 (x, y) 노드 번호
+         * @details 창 안 노드는 행 우선으로 이어 붙고, 연결은 양 끝이 창 안에 있는 접힘선만 만든다.
+         *          노드 수와 노드별 차수를 좌표로 계산해 노드 배열과 연결 목록을 한 번씩만 할당하고,
+         *          잠금과 검증도 창 전체에 한 번이다. make_element(x, y) 는 격자 좌표를 받아 요소를 만든다.
+         *          노드는 임시 배열에 모두 만든 뒤 붙이므로 make_element 가 던져도 패턴은 바뀌지 않는다.
+         */
+        template<typename ElementFactory>
+        size_t create_miura_tile(const miura_lattice& lattice, const miura_lattice::tile& window,
+                                 ElementFactory&& make_element) {
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
             
-            // 노드 생성
-            for (size_t i = 0; i < width * height; ++i) {
-                indices.push_back(add_element());
-            }
+            this->template get_policy<ValidationPolicy>().assert_that(
+                lattice.contains(window),
+                "Tile outside of the lattice"
+            );
             
-            // 연결 생성 (가로)
-            for (size_t y = 0; y < height; ++y) {
-                for (size_t x = 0; x < width - 1; ++x) {
-                    size_t idx = y * width + x;
-                    connect(idx, idx + 1);
-                    connect(idx + 1, idx);  // 양방향
+            // 창 전체를 먼저 만들고 끝에 붙인다 - make_element 가 던지면 패턴은 그대로다
+            const size_t base = nodes_.size();
+            std::vector<node> staged;
+            staged.reserve(window.node_count());
+            
+            std::array<size_t, miura_lattice::max_degree> neighbors{};
+            for (size_t y = window.y; y < window.y + window.height; ++y) {
+                for (size_t x = window.x; x < window.x + window.width; ++x) {
+                    size_t degree = 0;
+                    lattice.for_each_neighbor(x, y, window, [&](size_t nx, size_t ny) {
+                        // undirected 모드는 뒤쪽 이웃만 - 앞쪽 이웃은 역방향 색인으로 방문
+                        if (is_undirected() && (ny < y || (ny == y && nx < x))) return;
+                        if (degree == neighbors.size()) {
+                            throw std::length_error("Miura node has more than max_degree neighbors");
+                        }
+                        neighbors[degree++] = base + (ny - window.y) * window.width + (nx - window.x);
+                    });
+                    if (edge_options_.unique) {
+                        // 최대 max_degree 개라 삽입 정렬 - std::sort 의 16 원소 임계값 경로가 없다
+                        for (size_t i = 1; i < degree; ++i) {
+                            const size_t value = neighbors[i];
+                            size_t j = i;
+                            for (; j > 0 && neighbors[j - 1] > value; --j) neighbors[j] = neighbors[j - 1];
+                            neighbors[j] = value;
+                        }
+                    }
+                    const auto first = neighbors.begin();
+                    
+                    node& created = staged.emplace_back(make_element(x, y));
+                    created.connections.assign(first, first + degree);
                 }
             }
             
-            // 연결 생성 (세로)
-            for (size_t y = 0; y < height - 1; ++y) {
+            nodes_.reserve(base + staged.size());
+            try {
+                for (node& created : staged) nodes_.emplace_back(std::move(created));
+            } catch (...) {
+                nodes_.truncate(base);
+                throw;
+            }
+            lower_.reset();
+            numbering_.reset();
+            return base;
+        }
+        
+        size_t create_miura_tile(const miura_lattice& lattice, const miura_lattice::tile& window) {
+            return create_miura_tile(lattice, window, [](size_t, size_t) { return ElementType(); });
+        }
+        
+        /**
+         * @brief 연결 목록 없이 Miura 격자를 만든다 - 반환값은 (0, 0) 노드 번호
+         * @details visit_connections 가 이웃을 노드 번호에서 산술로 계산하므로 간선 메모리가 없다.
+         *          이후 이 구간 노드에 connect 하면 격자 이웃 뒤에 추가 연결로 방문된다.
+         *          패턴마다 암시적 구간은 하나만 둘 수 있다.
+         */
+        template<typename ElementFactory>
+        size_t create_implicit_miura_pattern(size_t width, size_t height, ElementFactory&& make_element) {
+            const miura_lattice lattice(width, height);
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
+            
+            this->template get_policy<ValidationPolicy>().assert_that(
+                !implicit_.has_value(),
+                "Pattern already has an implicit lattice"
+            );
+            
+            const size_t base = nodes_.size();
+            nodes_.reserve(base + lattice.node_count());
+            for (size_t y = 0; y < height; ++y) {
                 for (size_t x = 0; x < width; ++x) {
-                    size_t idx = y * width + x;
-                    connect(idx, idx + width);
-                    connect(idx + width, idx);  // 양방향
+                    nodes_.emplace_back(make_element(x, y));
                 }
             }
+            implicit_ = implicit_region{lattice, base};
+            numbering_.reset();
+            return base;
+        }
+        
+        size_t create_implicit_miura_pattern(size_t width, size_t height) {
+            return create_implicit_miura_pattern(width, height, [](size_t, size_t) { return ElementType(); });
+        }
+        
+        // node_index 의 연결이 격자 좌표로 계산되는지
+        bool is_implicit(size_t node_index) const noexcept {
+            return implicit_ && implicit_->contains(node_index);
+        }
+        
+        // 연결 수 (격자 + 명시적)
+        size_t degree(size_t node_index) const {
+            size_t count = 0;
+            visit_connections(node_index, [&count](size_t, size_t, const ElementType&, const ElementType&) { ++count; });
+            return count;
+        }
+        
+        /**
+         * @brief 노드 순서를 바꾸고 연결을 새 번호로 옮긴다 - order[새 번호] = 이전 번호
+         * @details 반환값은 이전 번호 → 새 번호 표로, 밖에서 들고 있던 노드 번호를 옮길 때 쓴다.
+         *          directed 모드의 연결 순서는 그대로다 (unique 설정이면 새 번호로 다시 정렬). 격자 좌표 산술은 행 우선 번호를 전제하므로 암시적 구간의
+         *          이웃은 명시적 연결로 풀어 쓴다. 기존 스냅샷은 이전 배열을 계속 본다.
+         *          새 배열을 다 만든 뒤에 바꾸므로 요소 복사가 예외를 던지면 패턴은 그대로다.
+         */
+        template<std::ranges::random_access_range Order>
+            requires std::integral<std::ranges::range_value_t<Order>>
+        std::vector<size_t> reorder(const Order& order) {
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
             
-            // 지그재그 대각선 (Miura-ori 특징)
-            for (size_t y = 0; y < height - 1; ++y) {
-                for (size_t x = 0; x < width - 1; ++x) {
-                    size_t idx = y * width + x;
-                    
-                    if ((x + y) % 2 == 0) {
-                        connect(idx, idx + width + 1);
-                        connect(idx + width + 1, idx);
-                    } else {
-                        connect(idx + 1, idx + width);
-                        connect(idx + width, idx + 1);
+            const size_t count = nodes_.size();
+            auto& validation = this->template get_policy<ValidationPolicy>();
+            validation.assert_that(static_cast<size_t>(std::ranges::size(order)) == count, "Reorder size mismatch");
+            
+            std::vector<size_t> new_index(count, count);
+            for (size_t i = 0; i < count; ++i) {
+                const auto previous = static_cast<size_t>(order[i]);
+                validation.assert_that(previous < count && new_index[previous] == count, "Reorder order is not a permutation");
+                new_index[previous] = i;
+            }
+            
+            // 요소는 복사한다 - 옮기면 스냅샷과 공유 중인 청크를 복사하고, 도중에 예외가 나면 원본이 깨진다
+            node_array reordered;
+            reordered.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                reordered.emplace_back(nodes_[static_cast<size_t>(order[i])].element);
+            }
+            
+            // undirected 모드는 새 번호에서 작은 끝으로 다시 옮기고, 격자 접힘선은 한 번만 쓴다
+            const bool undirected = is_undirected();
+            auto add = [&reordered, undirected](size_t from, size_t to) {
+                if (undirected && to < from) std::swap(from, to);
+                reordered.mutable_at(from).connections.push_back(to);
+            };
+            for (size_t previous = 0; previous < count; ++previous) {
+                const node& source = nodes_[previous];
+                const size_t from = new_index[previous];
+                if (implicit_ && implicit_->contains(previous)) {
+                    const size_t base = implicit_->base;
+                    if (!undirected) {
+                        reordered.mutable_at(from).connections.reserve(miura_lattice::max_degree + source.connections.size());
                     }
+                    implicit_->lattice.for_each_neighbor(previous - base, [&](size_t neighbor) {
+                        if (!undirected || base + neighbor > previous) add(from, new_index[base + neighbor]);
+                    });
+                } else if (!undirected) {
+                    reordered.mutable_at(from).connections.reserve(source.connections.size());
+                }
+                for (size_t connected : source.connections) {
+                    add(from, new_index[connected]);
+                }
+            }
+            if (edge_options_.unique) {
+                for (size_t i = 0; i < count; ++i) {
+                    auto& connections = reordered.mutable_at(i).connections;
+                    std::sort(connections.begin(), connections.end());
                 }
             }
+            
+            nodes_ = std::move(reordered);
+            implicit_.reset();
+            lower_.reset();
+            numbering_.reset();
+            return new_index;
         }
         
         // 요소 접근
@@ -121,13 +645,48 @@ namespace metaloki::origami {
             return nodes_[index].element;
         }
         
+        // 가변 접근 - 스냅샷과 공유 중인 청크면 먼저 복사
         ElementType& get_element(size_t index) {
             this->template get_policy<ValidationPolicy>().assert_that(
                 index < nodes_.size(),
                 "Invalid node index"
             );
             
-            return nodes_[index].element;
+            return nodes_.mutable_at(index).element;
+        }
+        
+        // 노드 수
+        size_t size() const noexcept { return nodes_.size(); }
+        
+        // 패턴 이름
+        const std::string& pattern_name() const noexcept { return pattern_name_; }
+        
+        // 연결이 차지하는 바이트 - 노드별 연결 목록 용량과 (만들어져 있으면) undirected 역방향 색인
+        size_t edge_memory() const {
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
+            
+            size_t bytes = 0;
+            nodes_.for_each_chunk([&bytes](const node* first, const node* last, size_t) {
+                for (const node* current = first; current != last; ++current) {
+                    bytes += current->connections.capacity() * sizeof(size_t);
+                }
+            });
+            if (lower_) {
+                bytes += lower_->offsets.capacity() * sizeof(size_t)
+                       + lower_->sources.capacity() * sizeof(std::uint32_t)
+                       + lower_->recent.capacity() * sizeof(lower_->recent.front());
+            }
+            return bytes;
+        }
+        
+        /**
+         * @brief 현재 노드/연결 배열을 불변 스냅샷으로 고정
+         * @details 스냅샷은 복사 비용이 작고 다른 스레드로 넘겨 동시에 읽을 수 있다
+         */
+        snapshot take_snapshot() const {
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
+            lower_connections();  // undirected 스냅샷은 역방향 색인을 함께 고정
+            return snapshot(nodes_.freeze(), pattern_name_, implicit_, lower_, shared_numbering());
         }
         
         // 검색 결과 [4] "traverse" 구현
@@ -135,10 +694,12 @@ namespace metaloki::origami {
         void traverse(Operation&& op) const {
             auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
             
-            // 모든 노드에 작업 적용
-            for (size_t i = 0; i < nodes_.size(); ++i) {
-                op(i, nodes_[i].element);
-            }
+            // 모든 노드에 작업 적용 (청크 단위 연속 구간)
+            nodes_.for_each_chunk([&op](const node* first, const node* last, size_t base) {
+                for (const node* current = first; current != last; ++current) {
+                    op(base + static_cast<size_t>(current - first), current->element);
+                }
+            });
         }
         
         // 검색 결과 [3] "connect_to" 흉내
@@ -151,16 +712,73 @@ namespace metaloki::origami {
                 "Invalid node index"
             );
             
-            const auto& node = nodes_[node_index];
-            for (size_t connected : node.connections) {
-                func(node_index, connected, node.element, nodes_[connected].element);
+            visit_node_connections(nodes_, implicit_, lower_connections(), node_index, func);
+        }
+        
+        /**
+         * @brief visit_connections 와 같은 순서로 func(from, to, edge_id)
+         * @details edge_id 는 접힘선이 작은 쪽 끝에서 처음 나온 순서의 번호라 edge_attributes 행으로 바로 쓴다.
+         *          접힘선 양 끝은 같은 번호를 받는다 - directed 모드는 a -> b 와 b -> a 연결을 짝지어 한 번호로,
+         *          짝이 없는 연결은 혼자 번호를 갖는다. crease_graph::from 과 매핑된 패턴의 번호와 같다.
+         *          연결이 바뀌면 번호를 다시 매기므로 (노드 수에 비례) 편집이 끝난 뒤 훑는 용도다.
+         */
+        template<typename Function>
+        void visit_connection_ids(size_t node_index, Function&& func) const {
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
+            
+            this->template get_policy<ValidationPolicy>().assert_that(
+                node_index < nodes_.size(),
+                "Invalid node index"
+            );
+            
+            const auto& numbering = fill_edge_numbering(*shared_numbering(), nodes_, implicit_);
+            visit_node_edges(nodes_, implicit_, lower_connections(), numbering, node_index, func);
+        }
+        
+        /**
+         * @brief 저장된 연결을 한 번씩 op(from, to, from_element, to_element)
+         * @details undirected 모드는 접힘선마다 한 번 (from <= to), directed 모드는 방향 연결마다 한 번.
+         *          역방향 색인을 만들지 않으므로 전체 연결을 훑는 가장 싼 방법이다.
+         */
+        template<typename Operation>
+        void for_each_edge(Operation&& op) const {
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
+            
+            const bool undirected = is_undirected();
+            for (size_t i = 0; i < nodes_.size(); ++i) {
+                const node& source = nodes_[i];
+                if (implicit_ && implicit_->contains(i)) {
+                    const size_t base = implicit_->base;
+                    implicit_->lattice.for_each_neighbor(i - base, [&](size_t neighbor) {
+                        if (!undirected || base + neighbor > i) op(i, base + neighbor, source.element, nodes_[base + neighbor].element);
+                    });
+                }
+                for (size_t connected : source.connections) {
+                    op(i, connected, source.element, nodes_[connected].element);
+                }
+            }
+        }
+        
+        // for_each_edge 가 방문하는 연결 수
+        size_t edge_count() const {
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
+            
+            size_t count = 0;
+            nodes_.for_each_chunk([&count](const node* first, const node* last, size_t) {
+                for (const node* current = first; current != last; ++current) count += current->connections.size();
+            });
+            if (implicit_) {
+                count += is_undirected() ? implicit_->lattice.edge_count() : implicit_->lattice.connection_count();
             }
+            return count;
         }
         
         // 렌더링 구현
         void render_impl() const {
+            auto lock = this->template get_policy<ThreadingPolicy>().get_lock();
+            
             std::cout << "Origami Pattern '" << pattern_name_ << "' with " 
-                      << nodes_.size() << " elements" << std::endl;
+                      << nodes_.size() << " elements" << '\n';
             
             for (size_t i = 0; i < nodes_.size(); ++i) {
                 std::cout << "Node " << i << ": ";
@@ -172,17 +790,21 @@ namespace metaloki::origami {
                 }
                 
                 std::cout << " -> Connections: ";
-                for (size_t conn : nodes_[i].connections) {
+                visit_node_connections(nodes_, implicit_, lower_connections(), i, [](size_t, size_t conn, const auto&, const auto&) {
                     std::cout << conn << " ";
-                }
-                std::cout << std::endl;
+                });
+                std::cout << '\n';
             }
         }
         
         // 복제 구현
         std::unique_ptr<origami_composite> clone_impl() const {
             auto clone = std::make_unique<origami_composite>(pattern_name_);
-            clone->nodes_ = nodes_;  // 복사 가능한 요소 사용
+            clone->nodes_ = nodes_;  // 청크 공유 - 이후 쓰기 시 건드린 청크만 복사
+            clone->implicit_ = implicit_;
+            clone->edge_options_ = edge_options_;
+            clone->lower_ = lower_;
+            clone->numbering_ = numbering_;
             return clone;
         }
     };
@@ -0,0 +1,257 @@
+/**
+ * @file include/origami/parallel_graph.hpp
+ * @brief 접힘선 그래프 병렬 알고리즘 - 레벨 동기 BFS, 연결 요소
+ * @details parallel_traversal 과 같은 work-stealing 풀과 parallel_options 를 쓴다.
+ *          노드 구간을 grain_size 단위로 fork 하고, 방문 비트맵과 라벨 배열은 std::atomic_ref 로
+ *          제자리에서 갱신하므로 결과 배열을 따로 복사하지 않는다.
+ */
+
+#pragma once
+
+#include <origami/graph_algorithms.hpp>
+#include <origami/parallel_traversal.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace metaloki::origami::graph {
+
+    namespace detail {
+
+        // [first, last) 를 grain 이하 구간으로 나눠 body(lo, hi) 를 병렬 실행
+        template<typename Body>
+        void parallel_for(optimization::work_stealing_pool& pool, std::size_t first, std::size_t last,
+                          std::size_t grain, Body& body) {
+            if (last - first <= grain) {
+                if (first < last) body(first, last);
+                return;
+            }
+            const std::size_t mid = first + (last - first) / 2;
+            pool.fork_join([&] { parallel_for(pool, first, mid, grain, body); },
+                           [&] { parallel_for(pool, mid, last, grain, body); });
+        }
+
+        // 비트 v 를 처음 세운 스레드만 true - 이미 세워져 있으면 RMW 없이 반환
+        inline bool try_claim(std::span<std::uint64_t> words, vertex v) noexcept {
+            std::atomic_ref<std::uint64_t> word(words[v >> 6]);
+            const std::uint64_t mask = std::uint64_t{1} << (v & 63);
+            if (word.load(std::memory_order_relaxed) & mask) return false;
+            return (word.fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+        }
+
+        // 더 작은 값일 때만 기록하고 기록했으면 true
+        inline bool atomic_min(vertex& target, vertex value) noexcept {
+            std::atomic_ref<vertex> ref(target);
+            vertex current = ref.load(std::memory_order_relaxed);
+            while (value < current) {
+                if (ref.compare_exchange_weak(current, value, std::memory_order_relaxed)) return true;
+            }
+            return false;
+        }
+
+        inline vertex load_label(const vertex& label) noexcept {
+            return std::atomic_ref<const vertex>(label).load(std::memory_order_relaxed);
+        }
+
+        // 워커별 다음 프론티어 버퍼 - 레벨 사이에 용량 유지
+        struct alignas(64) frontier_buffer {
+            std::vector<vertex> items;
+        };
+
+        /**
+         * @brief 호출 하나의 프론티어 버퍼 - 워커 슬롯마다 하나, 호출 스레드 하나, 공유 버퍼 하나
+         * @details 외부 스레드는 모두 같은 풀 슬롯을 쓰고, 기다리는 동안 다른 외부 호출의 작업을
+         *          훔쳐 실행하기도 한다. 그래서 외부 슬롯 버퍼는 이 호출을 시작한 스레드만 쓰고,
+         *          다른 외부 스레드는 지역 버퍼에 모았다가 잠금을 잡고 공유 버퍼에 붙인다.
+         */
+        class frontier_buffers {
+        private:
+            std::unique_ptr<frontier_buffer[]> buffers_;
+            std::size_t workers_;
+            std::thread::id caller_ = std::this_thread::get_id();
+            std::mutex shared_mutex_;
+
+        public:
+            explicit frontier_buffers(const optimization::work_stealing_pool& pool)
+                : buffers_(std::make_unique<frontier_buffer[]>(pool.slot_count() + 1)),
+                  workers_(pool.thread_count()) {}
+
+            // 워커 수 + 호출 스레드 + 공유
+            std::size_t size() const noexcept { return workers_ + 2; }
+
+            std::vector<vertex>& operator[](std::size_t index) noexcept { return buffers_[index].items; }
+
+            // fill(out) 으로 현재 스레드 몫을 채운다
+            template<typename Fill>
+            void collect(std::size_t slot, Fill&& fill) {
+                if (slot < workers_ || std::this_thread::get_id() == caller_) {
+                    fill(buffers_[slot].items);
+                    return;
+                }
+                std::vector<vertex> local;
+                fill(local);
+                if (local.empty()) return;
+                std::lock_guard lock(shared_mutex_);
+                auto& shared = buffers_[workers_ + 1].items;
+                shared.insert(shared.end(), local.begin(), local.end());
+            }
+        };
+    }
+
+    /**
+     * @brief 레벨 동기 병렬 BFS - source 에서의 깊이 (도달 못 하면 unreached)
+     * @details 레벨마다 프론티어를 grain_size 구간으로 나눠 확장한다. 방문 여부는 원자적 비트맵으로
+     *          한 스레드만 노드를 차지하고, 새 노드는 워커별 버퍼에 모았다가 다음 프론티어로 합친다.
+     *          결과는 bfs_depths 와 같다. 프론티어가 grain_size 이하인 레벨은 호출 스레드에서 바로 처리한다.
+     */
+    template<adjacency_graph Graph>
+    std::vector<std::uint32_t> parallel_bfs(const Graph& graph, vertex source, const parallel_options& options = {}) {
+        const std::size_t nodes = graph.node_count();
+        if (source >= nodes) throw std::out_of_range("parallel_bfs: source out of range");
+
+        auto& pool = options.pool ? *options.pool : optimization::work_stealing_pool::shared();
+        const std::size_t grain = std::max<std::size_t>(options.grain_size, 1);
+
+        std::vector<std::uint32_t> depths(nodes, unreached);
+        visited_set visited(nodes);
+        const auto words = visited.words();
+        visited.set(source);
+        depths[source] = 0;
+
+        detail::frontier_buffers buffers(pool);
+        const std::size_t slots = buffers.size();
+        std::vector<vertex> frontier{source};
+        std::vector<vertex> next;
+        std::vector<std::size_t> offsets(slots + 1);
+
+        for (std::uint32_t depth = 1; !frontier.empty(); ++depth) {
+            auto expand = [&](std::size_t lo, std::size_t hi) {
+                buffers.collect(pool.current_slot(), [&](std::vector<vertex>& out) {
+                    for (std::size_t i = lo; i < hi; ++i) {
+                        for (vertex u : graph.neighbors(frontier[i])) {
+                            if (detail::try_claim(words, u)) {
+                                depths[u] = depth;
+                                out.push_back(u);
+                            }
+                        }
+                    }
+                });
+            };
+            detail::parallel_for(pool, 0, frontier.size(), grain, expand);
+
+            // 워커 버퍼를 이어 붙여 다음 프론티어로
+            for (std::size_t s = 0; s < slots; ++s) offsets[s + 1] = offsets[s] + buffers[s].size();
+            next.resize(offsets[slots]);
+            auto gather = [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t s = lo; s < hi; ++s) {
+                    std::copy(buffers[s].begin(), buffers[s].end(), next.begin() + offsets[s]);
+                    buffers[s].clear();
+                }
+            };
+            if (next.size() > grain) {
+                detail::parallel_for(pool, 0, slots, 1, gather);
+            } else {
+                gather(0, slots);
+            }
+            std::swap(frontier, next);
+        }
+        return depths;
+    }
+
+    /**
+     * @brief 병렬 라벨 전파 연결 요소 - connected_components 와 같은 라벨
+     * @details 각 노드 라벨은 같은 요소의 더 작은 노드 번호만 가리킨다. 라운드마다 간선 양 끝의
+     *          조부모 라벨을 비교해 작은 쪽으로 부모와 자신을 원자적으로 내리고(hooking),
+     *          포인터 점프로 라벨을 뿌리까지 줄인다. 라벨이 요소 지름이 아닌 점프로 퍼지므로
+     *          격자처럼 지름이 큰 그래프도 적은 라운드에 수렴한다. 방향 간선은 무방향으로 본다.
+     */
+    template<adjacency_graph Graph>
+    component_labels parallel_connected_components(const Graph& graph, const parallel_options& options = {}) {
+        const std::size_t nodes = graph.node_count();
+        auto& pool = options.pool ? *options.pool : optimization::work_stealing_pool::shared();
+        const std::size_t grain = std::max<std::size_t>(options.grain_size, 1);
+
+        component_labels result;
+        auto& label = result.label;
+        label.resize(nodes);
+        std::iota(label.begin(), label.end(), vertex{0});
+
+        auto compress = [&label](std::size_t lo, std::size_t hi) {
+            for (std::size_t v = lo; v < hi; ++v) {
+                vertex parent = detail::load_label(label[v]);
+                vertex grand = detail::load_label(label[parent]);
+                while (grand != parent) {
+                    parent = grand;
+                    grand = detail::load_label(label[parent]);
+                }
+                std::atomic_ref<vertex>(label[v]).store(parent, std::memory_order_relaxed);
+            }
+        };
+
+        std::atomic<bool> changed = true;
+        auto hook = [&](std::size_t lo, std::size_t hi) {
+            bool local = false;
+            for (std::size_t i = lo; i < hi; ++i) {
+                const auto v = static_cast<vertex>(i);
+                for (vertex u : graph.neighbors(v)) {
+                    const vertex pv = detail::load_label(label[v]);
+                    const vertex pu = detail::load_label(label[u]);
+                    const vertex gv = detail::load_label(label[pv]);
+                    const vertex gu = detail::load_label(label[pu]);
+                    if (gu < gv) {
+                        local |= detail::atomic_min(label[pv], gu);
+                        local |= detail::atomic_min(label[v], gu);
+                    } else if (gv < gu) {
+                        local |= detail::atomic_min(label[pu], gv);
+                        local |= detail::atomic_min(label[u], gv);
+                    }
+                }
+            }
+            if (local) changed.store(true, std::memory_order_relaxed);
+        };
+
+        while (changed.load(std::memory_order_relaxed)) {
+            changed.store(false, std::memory_order_relaxed);
+            detail::parallel_for(pool, 0, nodes, grain, hook);
+            detail::parallel_for(pool, 0, nodes, grain, compress);
+        }
+
+        // 뿌리(label[v] == v)에 노드 번호 순서로 0..count-1 - 구간별 개수의 누적합
+        const std::size_t chunks = (nodes + grain - 1) / grain;
+        std::vector<vertex> chunk_base(chunks + 1, 0);
+        auto count_roots = [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t c = lo; c < hi; ++c) {
+                vertex roots = 0;
+                const std::size_t end = std::min(nodes, (c + 1) * grain);
+                for (std::size_t v = c * grain; v < end; ++v) roots += label[v] == v;
+                chunk_base[c + 1] = roots;
+            }
+        };
+        detail::parallel_for(pool, 0, chunks, 1, count_roots);
+        std::partial_sum(chunk_base.begin(), chunk_base.end(), chunk_base.begin());
+        result.count = chunk_base[chunks];
+
+        // 뿌리 번호를 먼저 매기고 (다른 노드가 아직 읽지 않도록 별도 배열) 전체에 반영
+        std::vector<vertex> root_id(nodes);
+        auto number_roots = [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t c = lo; c < hi; ++c) {
+                vertex next_id = chunk_base[c];
+                const std::size_t end = std::min(nodes, (c + 1) * grain);
+                for (std::size_t v = c * grain; v < end; ++v) {
+                    if (label[v] == v) root_id[v] = next_id++;
+                }
+            }
+        };
+        detail::parallel_for(pool, 0, chunks, 1, number_roots);
+
+        auto relabel = [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t v = lo; v < hi; ++v) label[v] = root_id[label[v]];
+        };
+        detail::parallel_for(pool, 0, nodes, grain, relabel);
+        return result;
+    }
+}
@@ -0,0 +1,261 @@
+/**
+ * @file include/origami/parallel_traversal.hpp
+ * @brief composite 트리의 병렬 순회 및 병렬 리덕션
+ * @details 서브트리 크기가 grain_size 를 넘는 구간만 work-stealing 풀로 fork 한다.
+ *          최상위 레벨은 composite 에 캐시된 자식 서브트리 누적합으로 노드 수 기준 균형 분할하고,
+ *          그 아래 레벨은 상위에서 물려받은 추정 크기로 분할한다.
+ *          기본 정책은 단일 스레드이며, 이 모듈은 명시적으로 사용할 때만 스레드를 쓴다.
+ */
+
+#pragma once
+
+#include <origami/composite.hpp>
+#include <optimization/work_stealing_pool.hpp>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <variant>
+
+namespace metaloki::origami {
+
+    /**
+     * @brief 리덕션 결합 순서
+     * @details deterministic: 트리 모양과 grain_size 에만 의존하는 고정된 결합 트리
+     *          (스레드 수/스케줄과 무관하게 결과 동일 - 부동소수 합에 권장)
+     *          unordered: 워커별 누적 후 합산 - combine 호출이 적지만 결합 순서가 스케줄에 의존
+     */
+    enum class reduction_order {
+        deterministic,
+        unordered
+    };
+
+    struct parallel_options {
+        // 이 노드 수 이하의 서브트리 구간은 fork 하지 않고 직렬 처리
+        std::size_t grain_size = 4096;
+        reduction_order order = reduction_order::deterministic;
+        // nullptr 이면 work_stealing_pool::shared()
+        optimization::work_stealing_pool* pool = nullptr;
+    };
+
+    namespace detail {
+
+        /**
+         * @brief 구간 분할 기반 병렬 리듀서
+         * @details map 은 노드 하나를 Result 로, combine 은 (왼쪽, 오른쪽) 을 순서대로 결합한다.
+         *          구간은 어느 variant 의 자식 배열이든 될 수 있어, 중첩 composite 로 내려가면
+         *          그 composite 의 자식 variant 로 같은 분할을 이어 간다.
+         */
+        template<typename Result, typename Map, typename Combine>
+        class parallel_reducer {
+        private:
+            struct alignas(64) slot {
+                std::optional<Result> value;
+            };
+
+            const Result& identity_;
+            Map& map_;
+            Combine& combine_;
+            optimization::work_stealing_pool& pool_;
+            const parallel_options& options_;
+            // unordered 모드 누적값 - 워커 슬롯마다 하나, 호출 스레드 하나, 다른 외부 스레드가 공유하는 하나
+            std::unique_ptr<slot[]> slots_;
+            std::thread::id caller_ = std::this_thread::get_id();
+            std::mutex shared_mutex_;
+
+        public:
+            parallel_reducer(const Result& identity, Map& map, Combine& combine,
+                             optimization::work_stealing_pool& pool, const parallel_options& options)
+                : identity_(identity), map_(map), combine_(combine), pool_(pool), options_(options) {
+                if (options_.order == reduction_order::unordered) {
+                    slots_ = std::make_unique<slot[]>(pool_.slot_count() + 1);
+                }
+            }
+
+            // offsets: 구간 원소별 서브트리 크기 누적합 (없으면 weight 로 추정)
+            template<typename Variant>
+            Result run(const Variant* first, const Variant* last, const std::size_t* offsets, std::size_t weight) {
+                if (options_.order == reduction_order::deterministic) {
+                    return reduce(first, last, offsets, weight);
+                }
+
+                fold(first, last, offsets, weight);
+
+                Result result = identity_;
+                for (std::size_t i = 0; i <= pool_.slot_count(); ++i) {
+                    if (slots_[i].value) {
+                        result = combine_(std::move(result), std::move(*slots_[i].value));
+                    }
+                }
+                return result;
+            }
+
+        private:
+            template<typename Variant>
+            Result serial(const Variant* first, const Variant* last) const {
+                Result accumulated = identity_;
+                for_each_preorder(first, last, [&](const auto& node) {
+                    accumulated = combine_(std::move(accumulated), map_(node));
+                });
+                return accumulated;
+            }
+
+            // 분할 지점과 양쪽 추정 크기
+            struct split_point {
+                std::size_t mid;
+                std::size_t left_weight;
+                std::size_t right_weight;
+            };
+
+            static split_point split(std::size_t count, const std::size_t* offsets, std::size_t weight) {
+                if (offsets) {
+                    // 노드 수 기준 절반 지점
+                    const std::size_t target = offsets[0] + (offsets[count] - offsets[0]) / 2;
+                    std::size_t mid = static_cast<std::size_t>(
+                        std::upper_bound(offsets + 1, offsets + count, target) - offsets);
+                    mid = std::clamp<std::size_t>(mid, 1, count - 1);
+                    return {mid, offsets[mid] - offsets[0], offsets[count] - offsets[mid]};
+                }
+
+                const std::size_t mid = count / 2;
+                const std::size_t left_weight = weight / count * mid;
+                return {mid, left_weight, weight - left_weight};
+            }
+
+            /**
+             * @brief 무거운 단일 노드 - map(노드) 결과를 자식이 없으면 on_leaf, 있으면 자식 구간과 함께 on_children 에
+             * @details 노드는 tree_walker 와 같은 타입으로 map 에 전달된다 (composite 는 기반 타입).
+             *          자식 구간의 variant 는 노드마다 다를 수 있으므로 on_children 은 제네릭이다.
+             */
+            template<typename Variant, typename OnLeaf, typename OnChildren>
+            decltype(auto) descend(const Variant& node, OnLeaf&& on_leaf, OnChildren&& on_children) {
+                return std::visit([&](const auto& element) {
+                    using node_type = typename walk_node<std::decay_t<decltype(element)>>::type;
+                    const node_type& current = element;
+                    Result self = map_(current);
+                    if constexpr (walkable_node<node_type>) {
+                        const auto& children = current.children();
+                        if (children.size() != 0) {
+                            return on_children(std::move(self), children.data(), children.data() + children.size());
+                        }
+                    }
+                    return on_leaf(std::move(self));
+                }, node);
+            }
+
+            template<typename Variant>
+            Result reduce(const Variant* first, const Variant* last, const std::size_t* offsets, std::size_t weight) {
+                const auto count = static_cast<std::size_t>(last - first);
+                if (weight <= options_.grain_size) {
+                    return serial(first, last);
+                }
+
+                if (count >= 2) {
+                    const auto [mid, left_weight, right_weight] = split(count, offsets, weight);
+                    std::optional<Result> left;
+                    std::optional<Result> right;
+
+                    pool_.fork_join(
+                        [&] { left.emplace(reduce(first, first + mid, offsets, left_weight)); },
+                        [&] { right.emplace(reduce(first + mid, last, offsets ? offsets + mid : nullptr, right_weight)); });
+
+                    return combine_(std::move(*left), std::move(*right));
+                }
+
+                // 자신을 먼저 결합하고 자식 구간으로 하강
+                return descend(*first,
+                    [](Result self) { return self; },
+                    [this, weight](Result self, const auto* child_first, const auto* child_last) {
+                        return combine_(std::move(self), reduce(child_first, child_last, nullptr, weight - 1));
+                    });
+            }
+
+            /**
+             * @brief 현재 스레드 몫에 value 를 더한다
+             * @details 외부 스레드는 모두 같은 풀 슬롯을 쓰고, 기다리는 동안 다른 외부 호출의 작업을
+             *          훔쳐 실행하기도 한다. 그래서 외부 슬롯은 이 리덕션을 시작한 스레드만 쓰고,
+             *          다른 외부 스레드는 잠금을 잡고 공유 슬롯에 더한다.
+             */
+            void accumulate(Result value) {
+                const std::size_t index = pool_.current_slot();
+                if (index < pool_.thread_count() || std::this_thread::get_id() == caller_) {
+                    add_to(slots_[index].value, std::move(value));
+                    return;
+                }
+                std::lock_guard lock(shared_mutex_);
+                add_to(slots_[pool_.slot_count()].value, std::move(value));
+            }
+
+            void add_to(std::optional<Result>& target, Result value) {
+                target = target ? combine_(std::move(*target), std::move(value)) : std::move(value);
+            }
+
+            template<typename Variant>
+            void fold(const Variant* first, const Variant* last, const std::size_t* offsets, std::size_t weight) {
+                const auto count = static_cast<std::size_t>(last - first);
+                if (weight <= options_.grain_size) {
+                    accumulate(serial(first, last));
+                    return;
+                }
+
+                if (count >= 2) {
+                    const auto [mid, left_weight, right_weight] = split(count, offsets, weight);
+                    pool_.fork_join(
+                        [&] { fold(first, first + mid, offsets, left_weight); },
+                        [&] { fold(first + mid, last, offsets ? offsets + mid : nullptr, right_weight); });
+                    return;
+                }
+
+                descend(*first,
+                    [this](Result self) { accumulate(std::move(self)); },
+                    [this, weight](Result self, const auto* child_first, const auto* child_last) {
+                        accumulate(std::move(self));
+                        fold(child_first, child_last, nullptr, weight - 1);
+                    });
+            }
+        };
+    }
+
+    /**
+     * @brief 트리 전체(루트 포함)를 병렬로 map 한 뒤 combine 으로 리덕션
+     * @details combine 은 결합 법칙을 만족해야 하며 identity 는 항등원이어야 한다.
+     *          map(node) 은 여러 스레드에서 동시에 호출될 수 있다.
+     *          deterministic 순서에서는 결과가 전위 순서의 왼쪽→오른쪽 결합과 같다.
+     */
+    template<detail::composite_tree Tree, typename Result, typename Map, typename Combine>
+    Result parallel_reduce(const Tree& tree, Result identity, Map&& map, Combine&& combine,
+                           const parallel_options& options = {}) {
+        auto& pool = options.pool ? *options.pool : optimization::work_stealing_pool::shared();
+
+        // 서브트리 크기 캐시는 fork 전에 호출 스레드에서 준비
+        const auto& children = tree.children();
+        const auto& offsets = tree.child_subtree_offsets();
+
+        Result root_value = map(tree);
+        if (children.empty()) {
+            return combine(std::move(identity), std::move(root_value));
+        }
+
+        detail::parallel_reducer<Result, std::remove_reference_t<Map>, std::remove_reference_t<Combine>>
+            reducer(identity, map, combine, pool, options);
+
+        Result body = reducer.run(children.data(), children.data() + children.size(), offsets.data(), offsets.back());
+        return combine(combine(std::move(identity), std::move(root_value)), std::move(body));
+    }
+
+    /**
+     * @brief composite::traverse 의 병렬 버전 - 루트와 모든 하위 노드에 op 적용
+     * @details 방문 순서는 보장하지 않으며 op 은 스레드 안전해야 한다
+     */
+    template<detail::composite_tree Tree, typename Operation>
+    void parallel_traverse(const Tree& tree, Operation&& op, const parallel_options& options = {}) {
+        parallel_reduce(tree, std::monostate{},
+            [&op](const auto& node) {
+                op(node);
+                return std::monostate{};
+            },
+            [](std::monostate, std::monostate) { return std::monostate{}; },
+            options);
+    }
+}
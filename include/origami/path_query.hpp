@@ -0,0 +1,195 @@
+/**
+ * @file include/origami/path_query.hpp
+ * @brief composite 경로 질의 - 한 번 컴파일해 반복 실행
+ * @details "section/para3", "*\/Row", "**\/Cell" 같은 '/' 구분 경로를 단계 목록으로 컴파일한다.
+ *          이름은 컴파일 시 name_id 로 바뀌므로 실행 중에는 문자열 비교가 없고,
+ *          넓은 노드는 composite 의 이름 색인으로 단계마다 O(1) 에 자식을 찾는다.
+ *
+ *          단계: 이름 - 그 이름의 자식 (composite 또는 name() 을 가진 자식)
+ *                *    - 모든 자식
+ *                **   - 0 단계 이상의 composite 하위 (마지막 단계면 모든 자손)
+ *          빈 경로는 루트 자신과 일치한다. "**" 를 여러 번 쓰면 같은 노드가 중복될 수 있다.
+ */
+
+#pragma once
+
+#include <origami/composite.hpp>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace metaloki::origami {
+
+    class path_query {
+    private:
+        enum class step_kind : unsigned char {
+            name,
+            any_child,
+            descendants
+        };
+
+        struct step {
+            step_kind kind;
+            name_id name;
+        };
+
+        std::vector<step> steps_;
+        std::string expression_;
+
+        // op 가 bool 을 반환하면 그 값으로 계속 여부 결정
+        template<typename Op, typename Element>
+        static bool emit(Op& op, const Element& element) {
+            if constexpr (std::is_convertible_v<std::invoke_result_t<Op&, const Element&>, bool>) {
+                return static_cast<bool>(op(element));
+            } else {
+                op(element);
+                return true;
+            }
+        }
+
+        // 자식 하나와 그 아래 모든 자손을 전달 (마지막 단계의 "**")
+        template<typename Op, typename Element>
+        bool emit_subtree(Op& op, const Element& element) const {
+            if (!emit(op, element)) return false;
+            if constexpr (detail::composite_tree<Element>) {
+                for (const auto& child : static_cast<const detail::composite_base_t<Element>&>(element).children()) {
+                    const bool keep_going = std::visit([this, &op](const auto& nested) {
+                        return emit_subtree(op, nested);
+                    }, child);
+                    if (!keep_going) return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief node 의 자식들에 대해 steps_[index..] 를 평가
+         * @details 중첩 composite 타입 깊이만큼만 재귀한다 (composite 는 자기 자신을 담을 수 없음)
+         */
+        template<std::size_t N, Component... ChildTypes, typename Op>
+        bool match(const basic_composite<N, ChildTypes...>& node, std::size_t index, Op& op) const {
+            const step& current = steps_[index];
+            const bool last = index + 1 == steps_.size();
+            const auto& children = node.children();
+
+            auto advance = [this, &op, index, last](const auto& child) {
+                return std::visit([this, &op, index, last](const auto& element) {
+                    using element_type = std::decay_t<decltype(element)>;
+                    if (last) return emit(op, element);
+                    if constexpr (detail::composite_tree<element_type>) {
+                        return match(static_cast<const detail::composite_base_t<element_type>&>(element), index + 1, op);
+                    } else {
+                        return true;
+                    }
+                }, child);
+            };
+
+            switch (current.kind) {
+                case step_kind::name:
+                    return node.for_each_child_named(current.name, [&](std::size_t position) {
+                        return advance(children[position]);
+                    });
+
+                case step_kind::any_child:
+                    for (const auto& child : children) {
+                        if (!advance(child)) return false;
+                    }
+                    return true;
+
+                case step_kind::descendants:
+                    if (last) {
+                        for (const auto& child : children) {
+                            const bool keep_going = std::visit([this, &op](const auto& element) {
+                                return emit_subtree(op, element);
+                            }, child);
+                            if (!keep_going) return false;
+                        }
+                        return true;
+                    }
+
+                    // 0 단계 - 다음 단계를 이 노드에서
+                    if (!match(node, index + 1, op)) return false;
+
+                    // 1 단계 이상 - 중첩 composite 로 내려가 "**" 를 유지
+                    for (const auto& child : children) {
+                        const bool keep_going = std::visit([this, &op, index](const auto& element) {
+                            using element_type = std::decay_t<decltype(element)>;
+                            if constexpr (detail::composite_tree<element_type>) {
+                                return match(static_cast<const detail::composite_base_t<element_type>&>(element), index, op);
+                            } else {
+                                return true;
+                            }
+                        }, child);
+                        if (!keep_going) return false;
+                    }
+                    return true;
+            }
+            return true;
+        }
+
+    public:
+        /**
+         * @brief 경로 식 컴파일 - 빈 구간('//', 앞뒤 '/')은 무시
+         * @details 처음 보는 이름은 전역 name_table 에 등록된다
+         */
+        explicit path_query(std::string_view expression) : expression_(expression) {
+            while (!expression.empty()) {
+                const auto separator = expression.find('/');
+                const std::string_view segment = expression.substr(0, separator);
+                expression = separator == std::string_view::npos ? std::string_view{} : expression.substr(separator + 1);
+
+                if (segment.empty()) continue;
+                if (segment == "**") {
+                    if (steps_.empty() || steps_.back().kind != step_kind::descendants) {
+                        steps_.push_back({step_kind::descendants, name_id{}});
+                    }
+                } else if (segment == "*") {
+                    steps_.push_back({step_kind::any_child, name_id{}});
+                } else {
+                    steps_.push_back({step_kind::name, intern_name(segment)});
+                }
+            }
+        }
+
+        static path_query compile(std::string_view expression) { return path_query(expression); }
+
+        const std::string& expression() const noexcept { return expression_; }
+        std::size_t step_count() const noexcept { return steps_.size(); }
+
+        /**
+         * @brief 일치하는 노드마다 op(node) - node 는 leaf/composite 등 실제 요소 타입
+         * @details op 가 false 를 반환하면 멈추고 false 를 반환한다
+         */
+        template<detail::composite_tree Tree, typename Op>
+        bool for_each(const Tree& root, Op&& op) const {
+            const auto& base = static_cast<const detail::composite_base_t<Tree>&>(root);
+            if (steps_.empty()) return emit(op, base);
+            return match(base, 0, op);
+        }
+
+        // 타입이 T 인 첫 일치 노드 - 없으면 nullptr
+        template<typename T, detail::composite_tree Tree>
+        const T* find_first(const Tree& root) const {
+            const T* found = nullptr;
+            for_each(root, [&found](const auto& node) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(node)>, T>) {
+                    found = &node;
+                    return false;
+                } else {
+                    return true;
+                }
+            });
+            return found;
+        }
+
+        template<detail::composite_tree Tree>
+        std::size_t count(const Tree& root) const {
+            std::size_t matches = 0;
+            for_each(root, [&matches](const auto&) { ++matches; });
+            return matches;
+        }
+    };
+}
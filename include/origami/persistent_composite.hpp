@@ -0,0 +1,220 @@
+/**
+ * @file include/origami/persistent_composite.hpp
+ * @brief 구조 공유(persistent) composite - O(1) 복제와 경로 복사 기반 변경
+ * @details 노드는 생성 후 변경되지 않으며 참조 카운트로 여러 버전이 공유한다.
+ *          변경 연산은 원본을 그대로 두고 새 버전을 반환하는데, 루트에서 변경 지점까지의
+ *          경로에 있는 노드만 복사하고 나머지 서브트리는 그대로 공유한다.
+ *          undo 스냅샷이나 버전 간 비교(diff)처럼 문서를 자주 복제하는 용도에 맞춘다.
+ */
+
+#pragma once
+
+#include <origami/composite.hpp>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace metaloki::origami {
+
+    template<Component... ChildTypes>
+    class persistent_composite;
+
+    namespace detail {
+        template<typename T>
+        struct is_persistent_composite : std::false_type {};
+
+        template<Component... ChildTypes>
+        struct is_persistent_composite<persistent_composite<ChildTypes...>> : std::true_type {};
+    }
+
+    /**
+     * @brief 불변 composite
+     * @details 중첩된 persistent_composite 자식은 포인터 하나로 복사되므로
+     *          노드 하나를 바꾸는 비용은 경로 길이 x 각 노드의 자식 수에 비례한다.
+     *          노드가 불변이므로 서로 다른 버전을 여러 스레드에서 동시에 읽어도 안전하다.
+     */
+    template<Component... ChildTypes>
+    class persistent_composite : public component_base<persistent_composite<ChildTypes...>> {
+    public:
+        using child_variant = std::variant<ChildTypes...>;
+        using child_list = std::vector<child_variant>;
+        using path_type = std::span<const std::size_t>;
+
+    private:
+        struct node {
+            std::string name;
+            child_list children;
+        };
+
+        std::shared_ptr<const node> node_;
+
+        explicit persistent_composite(std::shared_ptr<const node> shared) : node_(std::move(shared)) {}
+
+        // 자식 리스트를 복사해 수정한 새 노드 생성 (자식 서브트리는 공유)
+        template<typename Mutation>
+        persistent_composite with_children(Mutation&& mutation) const {
+            auto copy = std::make_shared<node>(*node_);
+            mutation(copy->children);
+            return persistent_composite(std::move(copy));
+        }
+
+        void check_index(std::size_t index) const {
+            if (index >= node_->children.size()) {
+                throw std::out_of_range("persistent_composite: child index out of range");
+            }
+        }
+
+        template<typename ChildType>
+        static constexpr bool is_child_type = (std::is_same_v<std::decay_t<ChildType>, ChildTypes> || ...);
+
+    public:
+        explicit persistent_composite(std::string name = "Composite")
+            : node_(std::make_shared<const node>(node{std::move(name), {}})) {}
+
+        // 기존 composite 의 현재 상태를 스냅샷으로 변환
+        template<std::size_t InlineChildren>
+        static persistent_composite from(const basic_composite<InlineChildren, ChildTypes...>& source) {
+            const auto& children = source.children();
+            return persistent_composite(std::make_shared<const node>(
+                node{std::string(source.name()), child_list(children.begin(), children.end())}));
+        }
+
+        // 가변 composite 로 복원
+        composite<ChildTypes...> to_composite() const {
+            composite<ChildTypes...> result(node_->name);
+            for (const auto& child : node_->children) {
+                std::visit([&result](const auto& element) { result.add_copy(element); }, child);
+            }
+            return result;
+        }
+
+        // 조회
+        const child_list& children() const { return node_->children; }
+        const std::string& name() const { return node_->name; }
+        std::size_t size() const { return node_->children.size(); }
+        bool empty() const { return node_->children.empty(); }
+
+        // 두 버전이 같은 노드를 공유하는지 (diff 에서 동일 서브트리를 건너뛰는 데 사용)
+        bool identical_to(const persistent_composite& other) const { return node_ == other.node_; }
+
+        // 변경 연산 - 모두 새 버전을 반환하고 원본은 그대로 둔다
+        template<Component ChildType>
+        [[nodiscard]] persistent_composite add(ChildType&& child) const {
+            static_assert(is_child_type<ChildType>, "Child type must be one of the supported types");
+
+            return with_children([&child](child_list& children) {
+                children.push_back(std::forward<ChildType>(child));
+            });
+        }
+
+        template<Component ChildType, typename... Args>
+        [[nodiscard]] persistent_composite emplace(Args&&... args) const {
+            static_assert(is_child_type<ChildType>, "Child type must be one of the supported types");
+
+            return with_children([&args...](child_list& children) {
+                children.push_back(ChildType(std::forward<Args>(args)...));
+            });
+        }
+
+        template<Component ChildType>
+        [[nodiscard]] persistent_composite set(std::size_t index, ChildType&& child) const {
+            static_assert(is_child_type<ChildType>, "Child type must be one of the supported types");
+            check_index(index);
+
+            return with_children([index, &child](child_list& children) {
+                children[index] = std::forward<ChildType>(child);
+            });
+        }
+
+        [[nodiscard]] persistent_composite erase(std::size_t index) const {
+            check_index(index);
+
+            return with_children([index](child_list& children) {
+                children.erase(children.begin() + static_cast<std::ptrdiff_t>(index));
+            });
+        }
+
+        [[nodiscard]] persistent_composite with_name(std::string name) const {
+            auto copy = std::make_shared<node>(node{std::move(name), node_->children});
+            return persistent_composite(std::move(copy));
+        }
+
+        /**
+         * @brief path 로 찾아간 자식에 update 를 적용한 새 버전 (경로 복사)
+         * @details path 의 마지막을 제외한 원소는 중첩된 persistent_composite 를 가리켜야 한다.
+         *          update 는 대상 요소를 받아 같은 타입의 새 요소를 반환한다.
+         *          경로 밖의 서브트리는 원본과 공유된다.
+         */
+        template<typename Update>
+        [[nodiscard]] persistent_composite update_in(path_type path, Update&& update) const {
+            if (path.empty()) {
+                throw std::invalid_argument("persistent_composite: empty update path");
+            }
+            check_index(path.front());
+
+            child_variant replaced = std::visit([&](const auto& element) -> child_variant {
+                using element_type = std::decay_t<decltype(element)>;
+
+                if (path.size() == 1) {
+                    if constexpr (std::is_invocable_r_v<element_type, Update&, const element_type&>) {
+                        return update(element);
+                    } else {
+                        throw std::invalid_argument("persistent_composite: update does not accept the target type");
+                    }
+                } else if constexpr (detail::is_persistent_composite<element_type>::value) {
+                    return element.update_in(path.subspan(1), update);
+                } else {
+                    throw std::invalid_argument("persistent_composite: path goes through a non-composite child");
+                }
+            }, node_->children[path.front()]);
+
+            const std::size_t index = path.front();
+            return with_children([index, &replaced](child_list& children) {
+                children[index] = std::move(replaced);
+            });
+        }
+
+        template<typename Update>
+        [[nodiscard]] persistent_composite update_in(std::initializer_list<std::size_t> path, Update&& update) const {
+            return update_in(path_type(path.begin(), path.size()), std::forward<Update>(update));
+        }
+
+        // 검색 결과 [5] "void print() const override"
+        void render_impl() const {
+            std::cout << "Composite '" << node_->name << "' {\n";
+
+            for (const auto& child : node_->children) {
+                std::visit([](const auto& c) {
+                    c.render();
+                }, child);
+                std::cout << '\n';
+            }
+
+            std::cout << "}";
+        }
+
+        // 루트 노드를 공유하므로 O(1)
+        std::unique_ptr<persistent_composite> clone_impl() const {
+            return std::unique_ptr<persistent_composite>(new persistent_composite(node_));
+        }
+
+        template<typename Operation>
+        void traverse(Operation&& op) const {
+            op(*this);
+
+            for (const auto& child : node_->children) {
+                std::visit([&op](const auto& c) {
+                    if constexpr (requires { c.traverse(op); }) {
+                        c.traverse(op);
+                    } else {
+                        op(c);
+                    }
+                }, child);
+            }
+        }
+    };
+}
@@ -0,0 +1,346 @@
+/**
+ * @file include/origami/renderer.hpp
+ * @brief composite / origami_composite 를 버퍼링된 출력 sink 로 스트리밍 렌더링
+ * @details render_impl 처럼 노드마다 std::cout 을 거치지 않고, 재사용 가능한 큰 버퍼에
+ *          std::to_chars 로 직접 기록한 뒤 버퍼가 찰 때만 sink 로 내보낸다.
+ *          전체 문자열을 만들지 않으므로 출력 크기와 무관하게 메모리 사용이 일정하다.
+ *          형식: JSON, compact text (name{child,child,...})
+ */
+
+#pragma once
+
+#include <origami/composite.hpp>
+#include <origami/origami_composite.hpp>
+#include <origami/small_buffer.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace metaloki::origami {
+
+    /**
+     * @brief 출력 sink 개념 - 연속 바이트 구간을 받는 write(data, size)
+     * @details std::ostream 도 그대로 만족한다
+     */
+    template<typename S>
+    concept OutputSink = requires(S& sink, const char* data, std::size_t size) {
+        sink.write(data, size);
+    };
+
+    // std::string 에 이어 붙이는 sink
+    struct string_sink {
+        std::string& target;
+
+        void write(const char* data, std::size_t size) { target.append(data, size); }
+    };
+
+    // C FILE* 로 내보내는 sink (stdout 등)
+    struct file_sink {
+        std::FILE* file;
+
+        void write(const char* data, std::size_t size) { std::fwrite(data, 1, size, file); }
+    };
+
+    enum class render_format {
+        json,
+        compact_text
+    };
+
+    /**
+     * @brief 고정 크기 버퍼를 채워 sink 로 내보내는 작성기
+     * @details 버퍼는 flush 후에도 유지되므로 작성기 하나로 여러 트리를 연속 렌더링할 수 있다.
+     *          소멸 시 남은 내용을 flush 한다.
+     */
+    template<OutputSink Sink>
+    class buffered_writer {
+    private:
+        Sink& sink_;
+        std::vector<char> buffer_;
+        std::size_t used_ = 0;
+
+        char* reserve(std::size_t size) {
+            if (used_ + size > buffer_.size()) {
+                flush();
+                if (size > buffer_.size()) buffer_.resize(size);
+            }
+            return buffer_.data() + used_;
+        }
+
+    public:
+        static constexpr std::size_t default_capacity = 64 * 1024;
+
+        explicit buffered_writer(Sink& sink, std::size_t capacity = default_capacity)
+            : sink_(sink), buffer_(std::max<std::size_t>(capacity, 64)) {}
+
+        ~buffered_writer() { flush(); }
+
+        buffered_writer(const buffered_writer&) = delete;
+        buffered_writer& operator=(const buffered_writer&) = delete;
+
+        void flush() {
+            if (used_ > 0) {
+                sink_.write(buffer_.data(), used_);
+                used_ = 0;
+            }
+        }
+
+        void put(char c) {
+            *reserve(1) = c;
+            ++used_;
+        }
+
+        void put(std::string_view text) {
+            // 버퍼보다 큰 문자열은 그대로 sink 로
+            if (text.size() > buffer_.size()) {
+                flush();
+                sink_.write(text.data(), text.size());
+                return;
+            }
+            std::memcpy(reserve(text.size()), text.data(), text.size());
+            used_ += text.size();
+        }
+
+        template<typename Number>
+            requires std::is_arithmetic_v<Number>
+        void put_number(Number value) {
+            constexpr std::size_t max_chars = 64;
+            char* first = reserve(max_chars);
+            const auto result = std::to_chars(first, first + max_chars, value);
+            used_ += static_cast<std::size_t>(result.ptr - first);
+        }
+
+        std::size_t capacity() const noexcept { return buffer_.size(); }
+    };
+
+    namespace detail {
+
+        // JSON 문자열 이스케이프
+        template<typename Writer>
+        void put_quoted(Writer& out, std::string_view text) {
+            static constexpr char hex[] = "0123456789abcdef";
+
+            out.put('"');
+            std::size_t plain = 0;
+            for (std::size_t i = 0; i < text.size(); ++i) {
+                const auto c = static_cast<unsigned char>(text[i]);
+                if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+                out.put(text.substr(plain, i - plain));
+                plain = i + 1;
+                switch (c) {
+                    case '"':  out.put("\\\""); break;
+                    case '\\': out.put("\\\\"); break;
+                    case '\n': out.put("\\n"); break;
+                    case '\r': out.put("\\r"); break;
+                    case '\t': out.put("\\t"); break;
+                    default:
+                        out.put("\\u00");
+                        out.put(hex[c >> 4]);
+                        out.put(hex[c & 0xF]);
+                }
+            }
+            out.put(text.substr(plain));
+            out.put('"');
+        }
+
+        /**
+         * @brief 값 하나 기록 - 수치/문자열은 직접, 그 외 스트림 출력 가능한 타입은 느린 경로
+         */
+        template<typename Writer, typename T>
+        void put_value(Writer& out, const T& value, render_format format) {
+            if constexpr (std::is_same_v<T, bool>) {
+                out.put(value ? std::string_view("true") : std::string_view("false"));
+            } else if constexpr (std::is_same_v<T, char>) {
+                put_quoted(out, std::string_view(&value, 1));
+            } else if constexpr (std::is_floating_point_v<T>) {
+                if (format == render_format::json && !std::isfinite(value)) {
+                    out.put("null");
+                } else {
+                    out.put_number(value);
+                }
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                out.put_number(value);
+            } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+                put_quoted(out, std::string_view(value));
+            } else if constexpr (requires(std::ostream& stream) { stream << value; }) {
+                thread_local std::ostringstream stream;
+                stream.str(std::string());
+                stream << value;
+                put_quoted(out, stream.view());
+            } else {
+                out.put(format == render_format::json ? std::string_view("null") : std::string_view("[Element]"));
+            }
+        }
+
+        /**
+         * @brief composite 트리 렌더러
+         * @details 중첩 composite 는 타입 깊이만큼만 재귀하고, 같은 variant 로 재귀하는
+         *          노드(섹션 등)는 명시적 스택으로 내려가므로 깊은 트리에서도 안전하다.
+         */
+        template<typename Writer>
+        class tree_renderer {
+        private:
+            Writer& out_;
+            render_format format_;
+
+            bool json() const { return format_ == render_format::json; }
+
+            template<typename Element>
+            void element(const Element& node) {
+                if constexpr (composite_tree<Element>) {
+                    composite_node(static_cast<const composite_base_t<Element>&>(node));
+                } else if constexpr (requires { node.value(); }) {
+                    put_value(out_, node.value(), format_);
+                } else {
+                    out_.put(json() ? std::string_view("null") : std::string_view("[Element]"));
+                }
+            }
+
+            template<typename Variant>
+            void children(const Variant* first, const Variant* last) {
+                struct frame {
+                    const Variant* next;
+                    const Variant* end;
+                    bool first;
+                };
+
+                const char open = json() ? '[' : '{';
+                const char close = json() ? ']' : '}';
+
+                inline_stack<frame, 32> stack;
+                out_.put(open);
+                stack.push({first, last, true});
+
+                while (!stack.empty()) {
+                    auto& top = stack.top();
+                    if (top.next == top.end) {
+                        stack.pop();
+                        out_.put(close);
+                        if (!stack.empty() && json()) out_.put('}');  // 섹션 객체 닫기
+                        continue;
+                    }
+
+                    const Variant& node = *top.next++;
+                    if (!top.first) out_.put(',');
+                    top.first = false;
+
+                    std::visit([this, &stack, open](const auto& item) {
+                        using item_type = std::decay_t<decltype(item)>;
+                        if constexpr (has_children_of<item_type, Variant>) {
+                            const auto& nested = item.children();
+                            if (json()) out_.put("{\"children\":");
+                            out_.put(open);
+                            stack.push({nested.data(), nested.data() + nested.size(), true});
+                        } else {
+                            element(item);
+                        }
+                    }, node);
+                }
+            }
+
+        public:
+            tree_renderer(Writer& out, render_format format) : out_(out), format_(format) {}
+
+            template<std::size_t InlineChildren, Component... ChildTypes>
+            void composite_node(const basic_composite<InlineChildren, ChildTypes...>& node) {
+                const auto& list = node.children();
+                if (json()) {
+                    out_.put("{\"name\":");
+                    put_quoted(out_, node.name());
+                    out_.put(",\"children\":");
+                    children(list.data(), list.data() + list.size());
+                    out_.put('}');
+                } else {
+                    out_.put(node.name());
+                    children(list.data(), list.data() + list.size());
+                }
+            }
+        };
+    }
+
+    /**
+     * @brief composite 트리를 작성기에 렌더링 (flush 는 호출자 또는 작성기 소멸 시)
+     */
+    template<typename Writer, detail::composite_tree Tree>
+    void render(Writer& out, const Tree& tree, render_format format = render_format::json) {
+        detail::tree_renderer<Writer>(out, format).composite_node(
+            static_cast<const detail::composite_base_t<Tree>&>(tree));
+    }
+
+    /**
+     * @brief origami_composite 패턴 렌더링
+     * @details JSON: {"pattern":..., "nodes":[{"id":0,"element":...,"connections":[...]}, ...]}
+     *          text: render_impl 과 같은 줄 단위 형식 (줄마다 flush 하지 않음)
+     */
+    template<typename Writer, typename ElementType, typename ThreadingPolicy, typename ValidationPolicy>
+    void render(Writer& out, const origami_composite<ElementType, ThreadingPolicy, ValidationPolicy>& pattern,
+                render_format format = render_format::json) {
+        const bool json = format == render_format::json;
+
+        if (json) {
+            out.put("{\"pattern\":");
+            detail::put_quoted(out, pattern.pattern_name());
+            out.put(",\"nodes\":[");
+        } else {
+            out.put("Origami Pattern '");
+            out.put(pattern.pattern_name());
+            out.put("' with ");
+            out.put_number(pattern.size());
+            out.put(" elements\n");
+        }
+
+        pattern.traverse([&](std::size_t index, const ElementType& element) {
+            if (json) {
+                if (index > 0) out.put(',');
+                out.put("{\"id\":");
+                out.put_number(index);
+                out.put(",\"element\":");
+                detail::put_value(out, element, format);
+                out.put(",\"connections\":[");
+            } else {
+                out.put("Node ");
+                out.put_number(index);
+                out.put(": ");
+                detail::put_value(out, element, format);
+                out.put(" -> Connections: ");
+            }
+
+            bool first = true;
+            pattern.visit_connections(index, [&](std::size_t, std::size_t to, const auto&, const auto&) {
+                if (json) {
+                    if (!first) out.put(',');
+                    out.put_number(to);
+                } else {
+                    out.put_number(to);
+                    out.put(' ');
+                }
+                first = false;
+            });
+
+            out.put(json ? std::string_view("]}") : std::string_view("\n"));
+        });
+
+        if (json) out.put("]}");
+    }
+
+    /**
+     * @brief sink 로 바로 렌더링 - 내부 버퍼를 만들어 쓰고 마지막에 flush
+     */
+    template<typename Source, OutputSink Sink>
+    void render_to(Sink& sink, const Source& source, render_format format = render_format::json,
+                   std::size_t buffer_capacity = buffered_writer<Sink>::default_capacity) {
+        buffered_writer<Sink> out(sink, buffer_capacity);
+        render(out, source, format);
+        out.flush();
+    }
+}
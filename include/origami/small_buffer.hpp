@@ -0,0 +1,420 @@
+/**
+ * @file include/origami/small_buffer.hpp
+ * @brief ORIGAMI 순회/저장용 인라인 버퍼 컨테이너
+ * @details 고정 용량 인라인 배열을 우선 사용하고 초과분만 힙으로 넘기는 구조
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace metaloki::origami {
+
+    /**
+     * @brief 인라인 용량 N 까지는 힙 할당이 없는 스택
+     * @details 트리 순회 프레임처럼 작고 trivially copyable 한 값 전용.
+     *          깊이가 N 을 넘을 때만 힙으로 spill 하며, 한 번 확보한 힙 용량은
+     *          clear() 이후에도 재사용된다.
+     */
+    template<typename T, std::size_t N>
+    class inline_stack {
+        static_assert(N > 0, "Inline capacity must be positive");
+        static_assert(std::is_trivially_copyable_v<T>,
+            "inline_stack is meant for trivially copyable frames");
+
+    private:
+        std::array<T, N> inline_;  // push 전에는 읽지 않으므로 0 으로 채우지 않는다
+        std::vector<T> spill_;
+        std::size_t size_ = 0;
+        bool spilled_ = false;
+
+    public:
+        static constexpr std::size_t inline_capacity = N;
+
+        inline_stack() = default;
+
+        void push(const T& value) {
+            if (!spilled_) {
+                if (size_ < N) {
+                    inline_[size_++] = value;
+                    return;
+                }
+
+                // 인라인 용량 초과 - 기존 요소를 힙으로 이동
+                spill_.reserve(N * 2);
+                spill_.assign(inline_.begin(), inline_.begin() + size_);
+                spilled_ = true;
+            }
+
+            spill_.push_back(value);
+            ++size_;
+        }
+
+        void pop() noexcept {
+            --size_;
+            if (spilled_) {
+                spill_.pop_back();
+                // 비었을 때만 인라인 모드로 복귀 (복사 없이 전환 가능)
+                if (size_ == 0) spilled_ = false;
+            }
+        }
+
+        T& top() noexcept { return spilled_ ? spill_.back() : inline_[size_ - 1]; }
+        const T& top() const noexcept { return spilled_ ? spill_.back() : inline_[size_ - 1]; }
+
+        // 바닥(0)부터의 인덱스 접근 - 조상 프레임 조회용
+        T& operator[](std::size_t index) noexcept {
+            return spilled_ ? spill_[index] : inline_[index];
+        }
+        const T& operator[](std::size_t index) const noexcept {
+            return spilled_ ? spill_[index] : inline_[index];
+        }
+
+        void clear() noexcept {
+            size_ = 0;
+            spill_.clear();
+            spilled_ = false;
+        }
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        bool spilled() const noexcept { return spilled_; }
+    };
+
+    namespace detail {
+        // small_vector 의 인라인 저장소 - N == 0 이면 공간을 차지하지 않음
+        template<typename T, std::size_t N>
+        struct inline_storage {
+            alignas(T) std::byte bytes[N * sizeof(T)];
+
+            T* get() noexcept { return reinterpret_cast<T*>(bytes); }
+            const T* get() const noexcept { return reinterpret_cast<const T*>(bytes); }
+        };
+
+        template<typename T>
+        struct inline_storage<T, 0> {
+            T* get() noexcept { return nullptr; }
+            const T* get() const noexcept { return nullptr; }
+        };
+    }
+
+    /**
+     * @brief 요소 N 개까지는 객체 안에 저장하고 넘칠 때만 힙을 쓰는 벡터
+     * @details composite 자식 목록용. 대부분의 노드는 자식이 몇 개뿐이므로 첫 add 마다 생기던
+     *          힙 할당이 사라진다. 반복자는 포인터이며 std::vector 처럼 연속 구간을 보장한다.
+     *          크기/용량은 32비트로 보관해 헤더가 16바이트다.
+     */
+    template<typename T, std::size_t N>
+    class small_vector {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr std::size_t inline_capacity = N;
+
+    private:
+        T* data_;
+        std::uint32_t size_ = 0;
+        std::uint32_t capacity_ = static_cast<std::uint32_t>(N);
+        [[no_unique_address]] detail::inline_storage<T, N> inline_;
+
+        static T* allocate(std::size_t count) {
+            return std::allocator<T>{}.allocate(count);
+        }
+
+        void release() noexcept {
+            if (!is_inline()) std::allocator<T>{}.deallocate(data_, capacity_);
+        }
+
+        // 용량을 정확히 capacity 로 - 요소는 이동 후 원본 파괴
+        void reallocate(std::size_t capacity) {
+            if (capacity > UINT32_MAX) throw std::length_error("small_vector: too many elements");
+
+            T* fresh = allocate(capacity);
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move(data_, data_ + size_, fresh);
+            } else {
+                try {
+                    std::uninitialized_copy(data_, data_ + size_, fresh);
+                } catch (...) {
+                    std::allocator<T>{}.deallocate(fresh, capacity);
+                    throw;
+                }
+            }
+            std::destroy(data_, data_ + size_);
+            release();
+            data_ = fresh;
+            capacity_ = static_cast<std::uint32_t>(capacity);
+        }
+
+        void grow_for(std::size_t required) {
+            if (required > capacity_) {
+                reallocate(std::max<std::size_t>({required, std::size_t{capacity_} * 2, 4}));
+            }
+        }
+
+        // 새 블록 끝에 [first, first + count) 를 만든 뒤 기존 요소를 옮긴다 - 구간이 기존 요소를 가리켜도 안전
+        template<typename ForwardIt>
+        void append_reallocating(ForwardIt first, std::size_t count) {
+            const std::size_t required = size_ + count;
+            if (required > UINT32_MAX) throw std::length_error("small_vector: too many elements");
+
+            const std::size_t capacity = std::max<std::size_t>({required, std::size_t{capacity_} * 2, 4});
+            T* fresh = allocate(capacity);
+            try {
+                std::uninitialized_copy_n(first, count, fresh + size_);
+            } catch (...) {
+                std::allocator<T>{}.deallocate(fresh, capacity);
+                throw;
+            }
+
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move(data_, data_ + size_, fresh);
+            } else {
+                try {
+                    std::uninitialized_copy(data_, data_ + size_, fresh);
+                } catch (...) {
+                    std::destroy(fresh + size_, fresh + required);
+                    std::allocator<T>{}.deallocate(fresh, capacity);
+                    throw;
+                }
+            }
+            std::destroy(data_, data_ + size_);
+            release();
+            data_ = fresh;
+            size_ = static_cast<std::uint32_t>(required);
+            capacity_ = static_cast<std::uint32_t>(capacity);
+        }
+
+        // 다른 small_vector 의 요소를 비어 있는 이 객체로 옮긴다
+        void take(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (!other.is_inline()) {
+                data_ = std::exchange(other.data_, other.inline_.get());
+                size_ = std::exchange(other.size_, 0);
+                capacity_ = std::exchange(other.capacity_, static_cast<std::uint32_t>(N));
+                return;
+            }
+            std::uninitialized_move(other.data_, other.data_ + other.size_, data_);
+            size_ = other.size_;
+            other.clear();
+        }
+
+    public:
+        // inline_ 은 data_ 뒤에 선언되어 있으므로 초기화 목록이 아니라 본문에서 가리킨다
+        small_vector() noexcept { data_ = inline_.get(); }
+
+        small_vector(std::initializer_list<T> values) : small_vector(values.begin(), values.end()) {}
+
+        template<std::input_iterator InputIt>
+        small_vector(InputIt first, InputIt last) : small_vector() {
+            insert(end(), first, last);
+        }
+
+        small_vector(const small_vector& other) : small_vector() {
+            reserve(other.size_);
+            std::uninitialized_copy(other.begin(), other.end(), data_);
+            size_ = other.size_;
+        }
+
+        small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : small_vector() {
+            take(std::move(other));
+        }
+
+        small_vector& operator=(const small_vector& other) {
+            if (this != &other) {
+                clear();
+                reserve(other.size_);
+                std::uninitialized_copy(other.begin(), other.end(), data_);
+                size_ = other.size_;
+            }
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (this != &other) {
+                clear();
+                if (!other.is_inline()) {
+                    release();
+                    data_ = inline_.get();
+                    capacity_ = static_cast<std::uint32_t>(N);
+                }
+                take(std::move(other));
+            }
+            return *this;
+        }
+
+        ~small_vector() {
+            std::destroy(data_, data_ + size_);
+            release();
+        }
+
+        // 요소 접근
+        T& operator[](std::size_t index) noexcept { return data_[index]; }
+        const T& operator[](std::size_t index) const noexcept { return data_[index]; }
+
+        T& at(std::size_t index) {
+            if (index >= size_) throw std::out_of_range("small_vector index out of range");
+            return data_[index];
+        }
+        const T& at(std::size_t index) const {
+            if (index >= size_) throw std::out_of_range("small_vector index out of range");
+            return data_[index];
+        }
+
+        T& front() noexcept { return data_[0]; }
+        const T& front() const noexcept { return data_[0]; }
+        T& back() noexcept { return data_[size_ - 1]; }
+        const T& back() const noexcept { return data_[size_ - 1]; }
+
+        T* data() noexcept { return data_; }
+        const T* data() const noexcept { return data_; }
+
+        // 반복자
+        iterator begin() noexcept { return data_; }
+        iterator end() noexcept { return data_ + size_; }
+        const_iterator begin() const noexcept { return data_; }
+        const_iterator end() const noexcept { return data_ + size_; }
+        const_iterator cbegin() const noexcept { return data_; }
+        const_iterator cend() const noexcept { return data_ + size_; }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        // 용량
+        bool empty() const noexcept { return size_ == 0; }
+        std::size_t size() const noexcept { return size_; }
+        std::size_t capacity() const noexcept { return capacity_; }
+        bool is_inline() const noexcept { return data_ == inline_.get(); }
+
+        void reserve(std::size_t capacity) {
+            if (capacity > capacity_) reallocate(capacity);
+        }
+
+        // 수정
+        void clear() noexcept {
+            std::destroy(data_, data_ + size_);
+            size_ = 0;
+        }
+
+        template<typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (size_ == capacity_) {
+                // 인자가 자신의 요소를 가리킬 수 있으므로 먼저 만든다
+                T value(std::forward<Args>(args)...);
+                grow_for(size_ + 1);
+                std::construct_at(data_ + size_, std::move(value));
+            } else {
+                std::construct_at(data_ + size_, std::forward<Args>(args)...);
+            }
+            return data_[size_++];
+        }
+
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        void pop_back() noexcept {
+            std::destroy_at(data_ + --size_);
+        }
+
+        template<typename... Args>
+        iterator emplace(const_iterator position, Args&&... args) {
+            const auto index = static_cast<std::size_t>(position - data_);
+            emplace_back(std::forward<Args>(args)...);
+            std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+            return data_ + index;
+        }
+
+        iterator insert(const_iterator position, const T& value) { return emplace(position, value); }
+        iterator insert(const_iterator position, T&& value) { return emplace(position, std::move(value)); }
+
+        /**
+         * @brief 구간 삽입 - 길이를 알 수 있으면 재할당은 최대 한 번
+         * @details 구간이 이 벡터 자신의 요소여도 된다 (c.insert(c.end(), c.begin(), c.end()) 등).
+         *          재할당이 필요하면 새 블록에 구간을 먼저 만들고 나서 기존 요소를 옮기므로,
+         *          구간은 원본이 살아 있는 동안 읽힌다. 단일 패스 input 반복자는 예외로,
+         *          이 벡터를 가리키면 재할당 시 무효가 된다.
+         */
+        template<std::input_iterator InputIt>
+        iterator insert(const_iterator position, InputIt first, InputIt last) {
+            const auto index = static_cast<std::size_t>(position - data_);
+            const std::size_t old_size = size_;
+            if constexpr (std::forward_iterator<InputIt>) {
+                const auto count = static_cast<std::size_t>(std::ranges::distance(first, last));
+                if (size_ + count > capacity_) {
+                    append_reallocating(first, count);
+                } else {
+                    for (; first != last; ++first) {
+                        std::construct_at(data_ + size_, *first);
+                        ++size_;
+                    }
+                }
+            } else {
+                if constexpr (std::sized_sentinel_for<InputIt, InputIt>) {
+                    grow_for(size_ + static_cast<std::size_t>(last - first));
+                }
+                for (; first != last; ++first) emplace_back(*first);
+            }
+            std::rotate(data_ + index, data_ + old_size, data_ + size_);
+            return data_ + index;
+        }
+
+        iterator insert(const_iterator position, std::initializer_list<T> values) {
+            return insert(position, values.begin(), values.end());
+        }
+
+        iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+        iterator erase(const_iterator first, const_iterator last) {
+            T* target = data_ + (first - data_);
+            const auto count = static_cast<std::size_t>(last - first);
+            if (count > 0) {
+                std::move(target + count, data_ + size_, target);
+                std::destroy(data_ + size_ - count, data_ + size_);
+                size_ -= static_cast<std::uint32_t>(count);
+            }
+            return target;
+        }
+
+        void resize(std::size_t count) {
+            if (count < size_) {
+                erase(begin() + count, end());
+                return;
+            }
+            grow_for(count);
+            std::uninitialized_value_construct(data_ + size_, data_ + count);
+            size_ = static_cast<std::uint32_t>(count);
+        }
+
+        void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            small_vector temporary(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temporary);
+        }
+
+        friend bool operator==(const small_vector& lhs, const small_vector& rhs) {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+    };
+}
@@ -0,0 +1,710 @@
+/**
+ * @file include/origami/stream_loader.hpp
+ * @brief 대용량 composite 를 위한 스트리밍 점진 로더 (pull parser)
+ * @details renderer.hpp 의 JSON 형식을 고정 크기 버퍼로 조금씩 읽으면서 노드 이벤트를 하나씩 반환한다.
+ *          파일 전체를 메모리에 올리지 않으며, 호출자가 언제든 읽기를 멈추거나
+ *          경로로 찾은 서브트리만 적재할 수 있다. 관심 없는 서브트리는 이벤트 없이 건너뛴다.
+ *
+ *          노드 형식: 값(숫자/문자열/true/false/null), {"name":..., "children":[...]} (composite),
+ *          {"children":[...]} (이름 없는 섹션). 이름은 children 앞에 와야 시작 이벤트에 실린다.
+ */
+
+#pragma once
+
+#include <origami/composite.hpp>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace metaloki::origami {
+
+    // complex_builder.hpp 를 끌어오지 않도록 전방 선언만 사용
+    template<typename... ComponentTypes>
+    class complex_origami_builder;
+
+    /**
+     * @brief 바이트 소스 개념 - read(buffer, capacity) 는 읽은 바이트 수, 끝이면 0
+     */
+    template<typename S>
+    concept ByteSource = requires(S& source, char* buffer, std::size_t capacity) {
+        { source.read(buffer, capacity) } -> std::convertible_to<std::size_t>;
+    };
+
+    // 메모리 구간 소스 (테스트/이미 읽어 둔 데이터용)
+    class memory_source {
+    private:
+        std::string_view data_;
+
+    public:
+        explicit memory_source(std::string_view data) : data_(data) {}
+
+        std::size_t read(char* buffer, std::size_t capacity) {
+            const std::size_t count = std::min(capacity, data_.size());
+            std::memcpy(buffer, data_.data(), count);
+            data_.remove_prefix(count);
+            return count;
+        }
+    };
+
+#if defined(__unix__) || defined(__APPLE__)
+    // 파일 디스크립터 소스 - fd 는 호출자가 소유
+    class fd_source {
+    private:
+        int fd_;
+
+    public:
+        explicit fd_source(int fd) : fd_(fd) {}
+
+        std::size_t read(char* buffer, std::size_t capacity) {
+            while (true) {
+                const auto count = ::read(fd_, buffer, capacity);
+                if (count >= 0) return static_cast<std::size_t>(count);
+                if (errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(), "stream loader: read failed");
+                }
+            }
+        }
+    };
+#endif
+
+    /**
+     * @brief pull parser 가 반환하는 이벤트
+     * @details name 과 문자열 값은 다음 next() 호출 전까지만 유효하다
+     */
+    struct tree_event {
+        enum class kind {
+            begin_node,  // composite 또는 섹션 시작
+            end_node,
+            value
+        };
+
+        using value_type = std::variant<std::monostate, bool, std::int64_t, double, std::string_view>;
+
+        kind type = kind::value;
+        std::size_t depth = 0;    // 루트 노드 = 0
+        std::string_view name;    // begin_node: composite 이름
+        bool named = false;       // begin_node: 이름이 있으면 composite, 없으면 섹션
+        value_type value;         // value: 노드 값 (null 은 monostate)
+    };
+
+    /**
+     * @brief 고정 버퍼 JSON 트리 pull parser
+     */
+    template<ByteSource Source>
+    class tree_reader {
+    private:
+        struct frame {
+            bool array;          // children 배열 / 노드 객체
+            bool first = true;
+            bool announced = false;
+            std::string name;
+            bool named = false;
+        };
+
+        Source& source_;
+        std::vector<char> buffer_;
+        std::size_t position_ = 0;
+        std::size_t end_ = 0;
+        bool exhausted_ = false;
+
+        std::vector<frame> stack_;
+        std::size_t open_frames_ = 0;  // stack_ 중 실제 사용 중인 수 (frame 의 name 버퍼 재사용)
+        std::size_t depth_ = 0;        // 열린 노드 객체 수
+        bool started_ = false;
+        bool finished_ = false;
+        bool pending_end_ = false;     // 자식 없이 닫힌 객체의 end 이벤트
+        std::string scratch_;          // 문자열 토큰 (버퍼 경계를 넘을 수 있음)
+        tree_event current_;
+
+        [[noreturn]] static void fail(const char* message) {
+            throw std::runtime_error(std::string("stream loader: ") + message);
+        }
+
+        bool refill() {
+            if (exhausted_) return false;
+            position_ = 0;
+            end_ = source_.read(buffer_.data(), buffer_.size());
+            if (end_ == 0) exhausted_ = true;
+            return end_ > 0;
+        }
+
+        int peek() {
+            if (position_ == end_ && !refill()) return -1;
+            return static_cast<unsigned char>(buffer_[position_]);
+        }
+
+        int get() {
+            const int c = peek();
+            if (c >= 0) ++position_;
+            return c;
+        }
+
+        int peek_token() {
+            while (true) {
+                const int c = peek();
+                if (c != ' ' && c != '\n' && c != '\r' && c != '\t') return c;
+                ++position_;
+            }
+        }
+
+        void expect(char expected) {
+            if (peek_token() != expected) fail("unexpected character");
+            ++position_;
+        }
+
+        frame& push(bool array) {
+            if (open_frames_ == stack_.size()) stack_.emplace_back();
+            frame& created = stack_[open_frames_++];
+            created.array = array;
+            created.first = true;
+            created.announced = false;
+            created.named = false;
+            created.name.clear();
+            return created;
+        }
+
+        void pop() { --open_frames_; }
+
+        frame& top() { return stack_[open_frames_ - 1]; }
+
+        static void append_utf8(std::string& out, std::uint32_t code) {
+            if (code < 0x80) {
+                out.push_back(static_cast<char>(code));
+            } else if (code < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            } else if (code < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            } else {
+                out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            }
+        }
+
+        std::uint32_t read_hex4() {
+            std::uint32_t code = 0;
+            for (int i = 0; i < 4; ++i) {
+                const int c = get();
+                code <<= 4;
+                if (c >= '0' && c <= '9') code |= static_cast<std::uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f') code |= static_cast<std::uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F') code |= static_cast<std::uint32_t>(c - 'A' + 10);
+                else fail("bad \\u escape");
+            }
+            return code;
+        }
+
+        // 여는 따옴표 다음부터 문자열을 out 에 읽는다 (store == false 면 버리기만)
+        void read_string(std::string& out, bool store) {
+            if (store) out.clear();
+            while (true) {
+                if (position_ == end_ && !refill()) fail("unterminated string");
+
+                // 특수 문자까지의 구간을 한 번에 복사
+                const char* first = buffer_.data() + position_;
+                const char* last = buffer_.data() + end_;
+                const char* stop = first;
+                while (stop != last && *stop != '"' && *stop != '\\') ++stop;
+                if (store) out.append(first, stop);
+                position_ += static_cast<std::size_t>(stop - first);
+                if (stop == last) continue;
+
+                if (get() == '"') return;
+
+                const int escaped = get();
+                std::uint32_t code = 0;
+                switch (escaped) {
+                    case '"': case '\\': case '/': code = static_cast<std::uint32_t>(escaped); break;
+                    case 'b': code = '\b'; break;
+                    case 'f': code = '\f'; break;
+                    case 'n': code = '\n'; break;
+                    case 'r': code = '\r'; break;
+                    case 't': code = '\t'; break;
+                    case 'u':
+                        code = read_hex4();
+                        if (code >= 0xD800 && code < 0xDC00) {
+                            if (get() != '\\' || get() != 'u') fail("bad surrogate pair");
+                            const std::uint32_t low = read_hex4();
+                            if (low < 0xDC00 || low > 0xDFFF) fail("bad surrogate pair");
+                            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                        } else if (code >= 0xDC00 && code <= 0xDFFF) {
+                            fail("unpaired low surrogate");
+                        }
+                        break;
+                    default:
+                        fail("bad escape");
+                }
+                if (store) append_utf8(out, code);
+            }
+        }
+
+        void read_literal(std::string_view literal) {
+            for (char expected : literal) {
+                if (get() != expected) fail("bad literal");
+            }
+        }
+
+        tree_event::value_type read_number() {
+            char digits[64];
+            std::size_t length = 0;
+            bool integral = true;
+            while (true) {
+                const int c = peek();
+                if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) break;
+                if (length == sizeof(digits)) fail("number too long");
+                if (c == '.' || c == 'e' || c == 'E') integral = false;
+                digits[length++] = static_cast<char>(c);
+                ++position_;
+            }
+
+            if (integral) {
+                std::int64_t value = 0;
+                const auto result = std::from_chars(digits, digits + length, value);
+                if (result.ec == std::errc() && result.ptr == digits + length) return value;
+            }
+            double value = 0;
+            const auto result = std::from_chars(digits, digits + length, value);
+            if (result.ec != std::errc() || result.ptr != digits + length) fail("bad number");
+            return value;
+        }
+
+        // 노드 하나의 시작 - 값이면 이벤트를 채우고 true, 객체면 프레임만 열고 false
+        bool begin_node() {
+            const int c = peek_token();
+            current_ = tree_event{};
+            current_.depth = depth_;
+
+            switch (c) {
+                case '{':
+                    ++position_;
+                    push(false);
+                    ++depth_;
+                    return false;
+                case '"':
+                    ++position_;
+                    read_string(scratch_, true);
+                    current_.value = std::string_view(scratch_);
+                    return true;
+                case 't': read_literal("true"); current_.value = true; return true;
+                case 'f': read_literal("false"); current_.value = false; return true;
+                case 'n': read_literal("null"); return true;
+                case -1: fail("unexpected end of input");
+                default:
+                    current_.value = read_number();
+                    return true;
+            }
+        }
+
+        void announce(frame& node) {
+            node.announced = true;
+            current_ = tree_event{};
+            current_.type = tree_event::kind::begin_node;
+            current_.depth = depth_ - 1;
+            current_.name = node.name;
+            current_.named = node.named;
+        }
+
+        void announce_end() {
+            current_ = tree_event{};
+            current_.type = tree_event::kind::end_node;
+            current_.depth = depth_;
+        }
+
+        // 값 하나(중첩 포함)를 이벤트 없이 건너뛴다
+        void skip_value() {
+            std::size_t nesting = 0;
+            do {
+                const int c = peek_token();
+                switch (c) {
+                    case -1: fail("unexpected end of input");
+                    case '"': ++position_; read_string(scratch_, false); break;
+                    case '{': case '[': ++position_; ++nesting; break;
+                    case '}': case ']': ++position_; --nesting; break;
+                    case ',': case ':': ++position_; break;
+                    default:
+                        if (c == 't' || c == 'f' || c == 'n') {
+                            ++position_;
+                            while (peek() >= 'a' && peek() <= 'z') ++position_;
+                        } else {
+                            read_number();
+                        }
+                }
+            } while (nesting > 0);
+        }
+
+    public:
+        static constexpr std::size_t default_buffer_size = 64 * 1024;
+
+        explicit tree_reader(Source& source, std::size_t buffer_size = default_buffer_size)
+            : source_(source), buffer_(std::max<std::size_t>(buffer_size, 16)) {}
+
+        /**
+         * @brief 다음 이벤트를 읽는다 - 입력 끝이면 false
+         */
+        bool next() {
+            if (pending_end_) {
+                pending_end_ = false;
+                --depth_;
+                announce_end();
+                return true;
+            }
+
+            while (true) {
+                if (open_frames_ == 0) {
+                    if (finished_) return false;
+                    if (!started_) {
+                        started_ = true;
+                        if (begin_node()) {
+                            finished_ = true;
+                            return true;
+                        }
+                        continue;
+                    }
+                    if (peek_token() != -1) fail("trailing data after root node");
+                    finished_ = true;
+                    return false;
+                }
+
+                frame& current = top();
+                if (current.array) {
+                    const int c = peek_token();
+                    if (c == ']') {
+                        ++position_;
+                        pop();
+                        continue;
+                    }
+                    if (!current.first) expect(',');
+                    current.first = false;
+                    if (begin_node()) return true;
+                    continue;
+                }
+
+                // 노드 객체의 키
+                const int c = peek_token();
+                if (c == '}') {
+                    ++position_;
+                    pop();
+                    if (!current.announced) {
+                        // 자식 없는 객체 - begin 을 먼저 내보내고 end 는 다음 호출에서
+                        announce(current);
+                        pending_end_ = true;
+                        return true;
+                    }
+                    --depth_;
+                    announce_end();
+                    return true;
+                }
+
+                if (!current.first) expect(',');
+                current.first = false;
+                expect('"');
+                read_string(scratch_, true);
+                expect(':');
+
+                if (scratch_ == "name") {
+                    expect('"');
+                    read_string(current.name, true);
+                    current.named = true;
+                } else if (scratch_ == "children") {
+                    if (current.announced) fail("duplicate children");
+                    expect('[');
+                    push(true);  // push 가 스택을 재할당할 수 있으므로 announce 는 그 다음에
+                    announce(stack_[open_frames_ - 2]);
+                    return true;
+                } else {
+                    skip_value();
+                }
+            }
+        }
+
+        const tree_event& current() const noexcept { return current_; }
+
+        /**
+         * @brief 방금 읽은 begin_node 의 나머지(자식 전체 포함)를 이벤트 없이 건너뛴다
+         */
+        void skip_subtree() {
+            if (current_.type != tree_event::kind::begin_node) {
+                fail("skip_subtree requires a begin_node event");
+            }
+            if (pending_end_) {
+                pending_end_ = false;
+                --depth_;
+                return;
+            }
+
+            // children 배열과 그 노드 객체의 남은 부분
+            std::size_t nesting = 2;
+            while (nesting > 0) {
+                const int c = peek_token();
+                switch (c) {
+                    case -1: fail("unexpected end of input");
+                    case '"': ++position_; read_string(scratch_, false); break;
+                    case '{': case '[': ++position_; ++nesting; break;
+                    case '}': case ']': ++position_; --nesting; break;
+                    default: ++position_;
+                }
+            }
+            pop();
+            pop();
+            --depth_;
+        }
+
+        /**
+         * @brief 이름 경로를 따라 내려가 해당 노드의 begin_node 직후에 멈춘다
+         * @details path[0] 은 루트 이름과 비교한다. 경로 밖의 서브트리는 건너뛰며,
+         *          찾지 못하면 false (이 경우 reader 위치는 정의되지 않음)
+         */
+        bool seek(std::span<const std::string_view> path) {
+            if (path.empty()) return false;
+            if (!next() || current_.type != tree_event::kind::begin_node || current_.name != path.front()) {
+                return false;
+            }
+
+            for (std::size_t level = 1; level < path.size(); ++level) {
+                const std::size_t child_depth = current_.depth + 1;
+                bool found = false;
+                while (!found) {
+                    if (!next() || current_.type == tree_event::kind::end_node) return false;
+                    if (current_.type != tree_event::kind::begin_node) continue;
+
+                    if (current_.depth == child_depth && current_.name == path[level]) {
+                        found = true;
+                    } else {
+                        skip_subtree();
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool seek(std::initializer_list<std::string_view> path) {
+            return seek(std::span<const std::string_view>(path.begin(), path.size()));
+        }
+    };
+
+    namespace detail {
+
+        // 값 이벤트를 받을 첫 번째 leaf 대안
+        template<typename Value, typename... ChildTypes>
+        struct leaf_for {
+            template<typename Child>
+            static constexpr bool accepts() {
+                if constexpr (requires(const Child& child) { child.value(); }) {
+                    using stored = std::decay_t<decltype(std::declval<const Child&>().value())>;
+                    if constexpr (std::is_same_v<Value, bool>) {
+                        return std::is_same_v<stored, bool>;
+                    } else if constexpr (std::is_same_v<Value, std::int64_t>) {
+                        return std::is_integral_v<stored> && !std::is_same_v<stored, bool>;
+                    } else if constexpr (std::is_same_v<Value, double>) {
+                        return std::is_floating_point_v<stored>;
+                    } else {
+                        return std::is_constructible_v<stored, std::string_view>;
+                    }
+                } else {
+                    return false;
+                }
+            }
+
+            static constexpr std::size_t index() {
+                constexpr std::array<bool, sizeof...(ChildTypes)> matches{accepts<ChildTypes>()...};
+                for (std::size_t i = 0; i < matches.size(); ++i) {
+                    if (matches[i]) return i;
+                }
+                // 정수는 실수 leaf 로도 받는다
+                if constexpr (std::is_same_v<Value, std::int64_t>) {
+                    return leaf_for<double, ChildTypes...>::index();
+                } else {
+                    return sizeof...(ChildTypes);
+                }
+            }
+        };
+
+        template<typename... ChildTypes>
+        constexpr std::size_t first_composite_index() {
+            constexpr std::array<bool, sizeof...(ChildTypes)> matches{composite_tree<ChildTypes>...};
+            for (std::size_t i = 0; i < matches.size(); ++i) {
+                if (matches[i]) return i;
+            }
+            return sizeof...(ChildTypes);
+        }
+
+        // 값 이벤트를 알맞은 leaf 로 만들어 sink(variant) 에 전달
+        template<typename Variant, typename Sink>
+        void deliver_value(const tree_event::value_type& value, Sink&& sink) {
+            std::visit([&sink](const auto& payload) {
+                using payload_type = std::decay_t<decltype(payload)>;
+                if constexpr (std::is_same_v<payload_type, std::monostate>) {
+                    return;  // null 은 대응하는 leaf 가 없으므로 무시
+                } else {
+                    [&]<typename... ChildTypes>(std::type_identity<std::variant<ChildTypes...>>) {
+                        constexpr std::size_t index = leaf_for<payload_type, ChildTypes...>::index();
+                        if constexpr (index == sizeof...(ChildTypes)) {
+                            throw std::runtime_error("stream loader: no child type accepts this value");
+                        } else {
+                            using child = std::variant_alternative_t<index, Variant>;
+                            using stored = std::decay_t<decltype(std::declval<const child&>().value())>;
+                            sink(Variant(std::in_place_index<index>, child(stored(payload))));
+                        }
+                    }(std::type_identity<Variant>{});
+                }
+            }, value);
+        }
+
+        /**
+         * @brief begin_node 다음부터 해당 노드의 end_node 까지 읽어 target 에 채운다
+         * @details 객체는 첫 번째 composite 대안으로 만들고, 대안이 없으면 건너뛴다.
+         *          중첩 노드는 부모에 먼저 추가한 뒤 그 자리에서 채운다 - 자식이 끝나기 전에는
+         *          부모가 바뀌지 않으므로 참조가 유효하다. 열린 노드마다 (대상, 타입별 처리 함수)
+         *          프레임 하나를 명시적 스택에 쌓으므로 깊이가 호출 스택을 쓰지 않는다.
+         */
+        template<typename Reader>
+        class children_loader {
+        private:
+            struct frame {
+                void* target;
+                void (*consume)(children_loader&, void*, const tree_event&);
+            };
+
+            Reader& reader_;
+            inline_stack<frame, 16> stack_;
+
+            template<std::size_t InlineChildren, Component... ChildTypes>
+            void open(basic_composite<InlineChildren, ChildTypes...>& target) {
+                stack_.push({&target, &children_loader::consume<InlineChildren, ChildTypes...>});
+            }
+
+            // 열린 노드 하나의 자식 이벤트 (end_node 제외)
+            template<std::size_t InlineChildren, Component... ChildTypes>
+            static void consume(children_loader& loader, void* target_ptr, const tree_event& event) {
+                using variant_type = std::variant<ChildTypes...>;
+                constexpr std::size_t nested_index = first_composite_index<ChildTypes...>();
+                auto& target = *static_cast<basic_composite<InlineChildren, ChildTypes...>*>(target_ptr);
+
+                if (event.type == tree_event::kind::value) {
+                    deliver_value<variant_type>(event.value, [&target](variant_type&& child) {
+                        std::visit([&target](auto&& element) { target.add(std::move(element)); }, std::move(child));
+                    });
+                } else if constexpr (nested_index == sizeof...(ChildTypes)) {
+                    loader.reader_.skip_subtree();
+                } else {
+                    using nested_type = std::variant_alternative_t<nested_index, variant_type>;
+                    target.add(nested_type{event.name});
+                    auto& nested = std::get<nested_index>(target.children().back());
+                    loader.open(static_cast<composite_base_t<nested_type>&>(nested));
+                }
+            }
+
+        public:
+            explicit children_loader(Reader& reader) : reader_(reader) {}
+
+            template<std::size_t InlineChildren, Component... ChildTypes>
+            void run(basic_composite<InlineChildren, ChildTypes...>& root) {
+                open(root);
+                while (!stack_.empty()) {
+                    if (!reader_.next()) {
+                        throw std::runtime_error("stream loader: unexpected end of input");
+                    }
+                    const auto& event = reader_.current();
+                    if (event.type == tree_event::kind::end_node) {
+                        stack_.pop();
+                        continue;
+                    }
+                    const frame top = stack_.top();
+                    top.consume(*this, top.target, event);
+                }
+            }
+        };
+
+        template<typename Reader, std::size_t InlineChildren, Component... ChildTypes>
+        void load_children(Reader& reader, basic_composite<InlineChildren, ChildTypes...>& target) {
+            children_loader<Reader>(reader).run(target);
+        }
+    }
+
+    /**
+     * @brief 스트림의 루트 노드 전체를 composite 로 적재
+     */
+    template<detail::composite_tree Tree, typename Reader>
+    Tree load_composite(Reader& reader) {
+        if (!reader.next() || reader.current().type != tree_event::kind::begin_node) {
+            throw std::runtime_error("stream loader: expected a composite node");
+        }
+        Tree result{reader.current().name};
+        detail::load_children(reader, static_cast<detail::composite_base_t<Tree>&>(result));
+        return result;
+    }
+
+    /**
+     * @brief 이름 경로의 서브트리만 적재 - 경로 앞뒤의 데이터는 이벤트 없이 건너뛰거나 읽지 않는다
+     */
+    template<detail::composite_tree Tree, typename Reader>
+    std::optional<Tree> load_subtree(Reader& reader, std::span<const std::string_view> path) {
+        if (!reader.seek(path)) return std::nullopt;
+        Tree result{reader.current().name};
+        detail::load_children(reader, static_cast<detail::composite_base_t<Tree>&>(result));
+        return result;
+    }
+
+    template<detail::composite_tree Tree, typename Reader>
+    std::optional<Tree> load_subtree(Reader& reader, std::initializer_list<std::string_view> path) {
+        return load_subtree<Tree>(reader, std::span<const std::string_view>(path.begin(), path.size()));
+    }
+
+    /**
+     * @brief 루트의 자식들을 complex_origami_builder 의 컴포넌트로 전달
+     * @details composite 자식은 그 이름으로, 값 자식은 위치 번호로 등록된다. 루트 이름은 무시한다.
+     */
+    template<typename Reader, typename... ComponentTypes>
+    void feed_builder(Reader& reader, complex_origami_builder<ComponentTypes...>& builder) {
+        using variant_type = std::variant<ComponentTypes...>;
+        constexpr std::size_t nested_index = detail::first_composite_index<ComponentTypes...>();
+
+        if (!reader.next() || reader.current().type != tree_event::kind::begin_node) {
+            throw std::runtime_error("stream loader: expected a composite node");
+        }
+
+        std::size_t position = 0;
+        while (reader.next()) {
+            const auto& event = reader.current();
+            if (event.type == tree_event::kind::end_node) return;
+
+            if (event.type == tree_event::kind::value) {
+                detail::deliver_value<variant_type>(event.value, [&](variant_type&& child) {
+                    std::visit([&](auto&& element) {
+                        builder.with_component(std::to_string(position), std::move(element));
+                    }, std::move(child));
+                });
+            } else if constexpr (nested_index == sizeof...(ComponentTypes)) {
+                reader.skip_subtree();
+            } else {
+                using nested_type = std::variant_alternative_t<nested_index, variant_type>;
+                std::string name(event.name);
+                nested_type nested{name};
+                detail::load_children(reader, static_cast<detail::composite_base_t<nested_type>&>(nested));
+                builder.with_component(std::move(name), std::move(nested));
+            }
+            ++position;
+        }
+        throw std::runtime_error("stream loader: unexpected end of input");
+    }
+}
@@ -6,56 +6,345 @@
 #pragma once
 
 #include <origami/composite.hpp>
-#include <queue>
-#include <stack>
+#include <origami/small_buffer.hpp>
+#include <concepts>
+#include <iterator>
+#include <vector>
 
 namespace metaloki::origami {
     
+    // 순회 방식 열거형
+    enum class traversal_order {
+        depth_first_preorder,   // 전위 순회
+        depth_first_postorder,  // 후위 순회
+        depth_first_inorder,    // 중위 순회 (첫 자식 서브트리 -> 자신 -> 나머지 자식)
+        breadth_first          // 레벨 순회
+    };
+    
     /**
      * @brief 검색 결과 [7] "BookShelfIterator" 스타일 트리 순회
+     * @details 자식 포인터를 하나씩 쌓는 대신 깊이마다 (cursor, end) 범위 하나만 유지한다.
+     *          DFS 계열은 inline_depth 까지 힙 할당이 전혀 없고, BFS 는 복합 노드당 범위 하나만
+     *          큐에 넣으며 reset() 이후에도 확보한 용량을 재사용한다.
+     *          begin()/end() 로 std::ranges 알고리즘과 조합할 수 있는 forward range 이기도 하다.
+     *          인라인 자식 용량이 다른 basic_composite<N, ...> 도 그 타입으로 순회한다.
      */
-    template<Component... ComponentTypes>
-    class tree_iterator {
+    template<typename Composite>
+    class basic_tree_iterator;
+    
+    template<std::size_t InlineChildren, Component... ComponentTypes>
+    class basic_tree_iterator<basic_composite<InlineChildren, ComponentTypes...>> {
     public:
-        using composite_type = composite<ComponentTypes...>;
+        using composite_type = basic_composite<InlineChildren, ComponentTypes...>;
         using variant_type = std::variant<ComponentTypes...>;
         
+        // 힙 spill 없이 처리되는 최대 깊이
+        static constexpr std::size_t inline_depth = 32;
+        
         // 순회 방식 열거형
-        enum class traversal_order {
-            depth_first_preorder,   // 전위 순회
-            depth_first_postorder,  // 후위 순회
-            breadth_first          // 레벨 순회
-        };
+        using traversal_order = origami::traversal_order;
         
     private:
+        // 중위 순회에서 부모 노드의 방출 상태
+        enum class parent_state : unsigned char {
+            before_first_child,  // 첫 자식 서브트리 진행 중
+            pending,             // 첫 자식 완료 - 부모 방출 대기
+            emitted              // 부모 방출 완료
+        };
+        
+        // 아직 방문하지 않은 형제 구간 [next, end)
+        struct child_range {
+            const variant_type* next;
+            const variant_type* end;
+            std::size_t depth;
+            parent_state parent;
+        };
+        
+        /**
+         * @brief 순회 상태 - tree_iterator 와 STL iterator 가 공유
+         * @details advance() 는 다음 노드를 반환하고, 끝이면 nullptr
+         */
+        class traversal_state {
+        private:
+            traversal_order order_ = traversal_order::depth_first_preorder;
+            inline_stack<child_range, inline_depth> dfs_stack_;  // DFS용 - 깊이당 프레임 하나
+            std::vector<child_range> bfs_queue_;                 // BFS용 - 복합 노드당 범위 하나
+            std::size_t bfs_head_ = 0;
+            std::size_t depth_ = 0;
+            
+        public:
+            traversal_state() = default;
+            
+            traversal_state(const composite_type* root, traversal_order order) : order_(order) {
+                restart(root);
+            }
+            
+            traversal_order order() const noexcept { return order_; }
+            
+            // 마지막으로 반환한 노드의 깊이 (루트의 자식 = 1)
+            std::size_t depth() const noexcept { return depth_; }
+            
+            void restart(const composite_type* root) {
+                dfs_stack_.clear();
+                bfs_queue_.clear();
+                bfs_head_ = 0;
+                depth_ = 0;
+                
+                if (!root || root->children().empty()) return;
+                
+                const auto range = make_range(root->children(), 1);
+                if (order_ == traversal_order::breadth_first) {
+                    bfs_queue_.push_back(range);
+                } else {
+                    dfs_stack_.push(range);
+                }
+            }
+            
+            void restart(const composite_type* root, traversal_order order) {
+                order_ = order;
+                restart(root);
+            }
+            
+            bool has_next() const noexcept {
+                return order_ == traversal_order::breadth_first
+                    ? bfs_head_ < bfs_queue_.size()
+                    : !dfs_stack_.empty();
+            }
+            
+            const variant_type* advance() {
+                if (!has_next()) return nullptr;
+                
+                switch (order_) {
+                    case traversal_order::depth_first_preorder:
+                        return advance_preorder();
+                    case traversal_order::depth_first_postorder:
+                        return advance_postorder();
+                    case traversal_order::depth_first_inorder:
+                        return advance_inorder();
+                    case traversal_order::breadth_first:
+                        return advance_bfs();
+                }
+                return nullptr;
+            }
+            
+        private:
+            template<typename Children>
+            static child_range make_range(const Children& children, std::size_t depth) {
+                return {children.data(), children.data() + children.size(),
+                        depth, parent_state::before_first_child};
+            }
+            
+            // 복합 노드면 자식 구간을 반환, 아니면 빈 구간
+            static child_range children_of(const variant_type& element, std::size_t depth) {
+                return std::visit([depth](const auto& node) -> child_range {
+                    using node_type = std::decay_t<decltype(node)>;
+                    if constexpr (detail::has_children_of<node_type, variant_type>) {
+                        return make_range(node.children(), depth);
+                    } else {
+                        static_assert(!requires { node.children(); },
+                            "tree_iterator can only descend into children of the same variant type");
+                        return {nullptr, nullptr, depth, parent_state::before_first_child};
+                    }
+                }, element);
+            }
+            
+            static bool has_children(const child_range& range) noexcept {
+                return range.next != range.end;
+            }
+            
+            const variant_type* advance_preorder() {
+                auto& frame = dfs_stack_.top();
+                const variant_type* current = frame.next++;
+                depth_ = frame.depth;
+                
+                // 소진된 구간은 즉시 제거 - 스택에는 항상 남은 형제가 있는 구간만 존재
+                if (frame.next == frame.end) {
+                    dfs_stack_.pop();
+                }
+                
+                // 현재 노드가 composite인 경우 자식 구간 하나만 추가
+                const auto children = children_of(*current, depth_ + 1);
+                if (has_children(children)) {
+                    dfs_stack_.push(children);
+                }
+                
+                return current;
+            }
+            
+            const variant_type* advance_postorder() {
+                const variant_type* current = nullptr;
+                
+                for (;;) {
+                    auto& frame = dfs_stack_.top();
+                    
+                    if (frame.next == frame.end) {
+                        // 자식 구간 완료 - 부모 프레임이 가리키는 복합 노드를 방출
+                        dfs_stack_.pop();
+                        auto& parent = dfs_stack_.top();
+                        depth_ = parent.depth;
+                        current = parent.next++;
+                        break;
+                    }
+                    
+                    // 가장 왼쪽 단말까지 하강
+                    const auto children = children_of(*frame.next, frame.depth + 1);
+                    if (has_children(children)) {
+                        dfs_stack_.push(children);
+                        continue;
+                    }
+                    
+                    depth_ = frame.depth;
+                    current = frame.next++;
+                    break;
+                }
+                
+                // 최상위 구간이 소진되면 남은 노드 없음 (루트 자신은 방출하지 않음)
+                if (dfs_stack_.size() == 1 && dfs_stack_.top().next == dfs_stack_.top().end) {
+                    dfs_stack_.pop();
+                }
+                
+                return current;
+            }
+            
+            const variant_type* advance_inorder() {
+                for (;;) {
+                    auto& frame = dfs_stack_.top();
+                    
+                    // 첫 자식 서브트리가 끝났으면 부모를 방출
+                    if (frame.parent == parent_state::pending) {
+                        frame.parent = parent_state::emitted;
+                        depth_ = frame.depth - 1;
+                        const variant_type* parent = dfs_stack_[dfs_stack_.size() - 2].next;
+                        drain_exhausted_inorder();
+                        return parent;
+                    }
+                    
+                    if (frame.next == frame.end) {
+                        // 서브트리 완료 - 부모는 이미 방출되었으므로 다음 형제로 이동
+                        dfs_stack_.pop();
+                        if (dfs_stack_.empty()) return nullptr;
+                        complete_child(dfs_stack_.top());
+                        continue;
+                    }
+                    
+                    const auto children = children_of(*frame.next, frame.depth + 1);
+                    if (has_children(children)) {
+                        dfs_stack_.push(children);
+                        continue;
+                    }
+                    
+                    // 단말(또는 빈 복합 노드) 방출
+                    depth_ = frame.depth;
+                    const variant_type* current = frame.next;
+                    complete_child(frame);
+                    
+                    // 마지막 노드였다면 남은 프레임을 정리해 has_next() 를 정확히 유지
+                    drain_exhausted_inorder();
+                    return current;
+                }
+            }
+            
+            void complete_child(child_range& frame) noexcept {
+                ++frame.next;
+                if (frame.parent == parent_state::before_first_child && dfs_stack_.size() > 1) {
+                    frame.parent = parent_state::pending;
+                }
+            }
+            
+            void drain_exhausted_inorder() noexcept {
+                // 방출할 부모 없이 소진된 프레임만 남았으면 순회 종료
+                // (조상 프레임의 next 는 진행 중인 서브트리를 가리키므로 그 다음 형제를 확인,
+                //  최상위가 아닌 프레임의 부모가 아직 방출 전이면 남은 작업이 있음)
+                const std::size_t top = dfs_stack_.size() - 1;
+                for (std::size_t i = dfs_stack_.size(); i-- > 0;) {
+                    const auto& frame = dfs_stack_[i];
+                    const auto* remaining = i == top ? frame.next : frame.next + 1;
+                    if (remaining != frame.end) return;
+                    if (i > 0 && frame.parent != parent_state::emitted) return;
+                }
+                dfs_stack_.clear();
+            }
+            
+            const variant_type* advance_bfs() {
+                auto& front = bfs_queue_[bfs_head_];
+                const variant_type* current = front.next++;
+                depth_ = front.depth;
+                
+                if (front.next == front.end && ++bfs_head_ == bfs_queue_.size()) {
+                    // 큐가 비면 앞부분을 재사용
+                    bfs_queue_.clear();
+                    bfs_head_ = 0;
+                }
+                
+                // 현재 노드가 composite인 경우 자식 구간을 큐에 추가
+                const auto children = children_of(*current, depth_ + 1);
+                if (has_children(children)) {
+                    bfs_queue_.push_back(children);
+                }
+                
+                return current;
+            }
+        };
+        
         const composite_type* root_;
-        traversal_order order_;
-        std::stack<const variant_type*> dfs_stack_;  // DFS용
-        std::queue<const variant_type*> bfs_queue_;  // BFS용
+        traversal_state state_;
         const variant_type* current_;
         
     public:
-        // 검색 결과 [7] "Iterator 생성자" 패턴
-        explicit tree_iterator(const composite_type* root, 
-                              traversal_order order = traversal_order::depth_first_preorder)
-            : root_(root), order_(order), current_(nullptr) {
+        /**
+         * @brief std::forward_iterator 를 만족하는 위치 기반 iterator
+         * @details 순회 상태를 값으로 보유하므로 복사본은 독립적으로 진행한다 (multi-pass)
+         */
+        class iterator {
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = variant_type;
+            using pointer = const variant_type*;
+            using reference = const variant_type&;
+            
+        private:
+            traversal_state state_;
+            const variant_type* current_ = nullptr;
             
-            if (root_ && !root_->children().empty()) {
-                initialize_traversal();
+        public:
+            iterator() = default;
+            
+            iterator(const composite_type* root, traversal_order order)
+                : state_(root, order), current_(state_.advance()) {}
+            
+            reference operator*() const { return *current_; }
+            pointer operator->() const { return current_; }
+            
+            // 현재 노드의 깊이 (루트의 자식 = 1)
+            std::size_t depth() const noexcept { return state_.depth(); }
+            
+            iterator& operator++() {
+                current_ = state_.advance();
+                return *this;
             }
-        }
+            
+            iterator operator++(int) {
+                iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+            
+            // 순회 중 각 노드는 한 번만 방문되므로 현재 노드로 위치를 비교
+            bool operator==(const iterator& other) const noexcept {
+                return current_ == other.current_;
+            }
+        };
+        
+        // 검색 결과 [7] "Iterator 생성자" 패턴
+        explicit basic_tree_iterator(const composite_type* root, 
+                                     traversal_order order = traversal_order::depth_first_preorder)
+            : root_(root), state_(root, order), current_(nullptr) {}
         
         // 검색 결과 [7] "hasNext()" 구현
         bool has_next() const {
-            switch (order_) {
-                case traversal_order::depth_first_preorder:
-                case traversal_order::depth_first_postorder:
-                    return !dfs_stack_.empty();
-                case traversal_order::breadth_first:
-                    return !bfs_queue_.empty();
-                default:
-                    return false;
-            }
+            return state_.has_next();
         }
         
         // 검색 결과 [7] "next()" 구현
@@ -64,18 +353,17 @@ namespace metaloki::origami {
                 throw std::runtime_error("No more elements to iterate");
             }
             
-            switch (order_) {
-                case traversal_order::depth_first_preorder:
-                    return next_dfs_preorder();
-                case traversal_order::depth_first_postorder:
-                    return next_dfs_postorder();
-                case traversal_order::breadth_first:
-                    return next_bfs();
-                default:
-                    throw std::runtime_error("Invalid traversal order");
-            }
+            current_ = state_.advance();
+            return *current_;
         }
         
+        // 마지막으로 next() 가 반환한 노드의 깊이 (레벨 순회 시 레벨 번호)
+        std::size_t current_depth() const noexcept { return state_.depth(); }
+        
+        // 현재 순회 순서 기준 전체 트리 range
+        iterator begin() const { return iterator(root_, state_.order()); }
+        iterator end() const { return iterator(); }
+        
         // 검색 결과 [1] "traverse operator" 스타일 함수형 순회
         template<typename Operation>
         void for_each(Operation&& op) {
@@ -87,6 +375,18 @@ namespace metaloki::origami {
             }
         }
         
+        // 깊이를 함께 전달하는 순회 - op(node, depth)
+        template<typename Operation>
+        void for_each_with_depth(Operation&& op) {
+            while (has_next()) {
+                const auto& element = next();
+                const auto depth = current_depth();
+                std::visit([&op, depth](const auto& value) {
+                    op(value, depth);
+                }, element);
+            }
+        }
+        
         // 검색 결과 [6] "collect" 함수 - 순회하면서 결과 수집
         template<typename Transform>
         auto collect(Transform&& transform) {
@@ -102,86 +402,21 @@ namespace metaloki::origami {
         
         // 현재 순회 순서 변경
         void set_traversal_order(traversal_order new_order) {
-            order_ = new_order;
-            reset();
+            state_.restart(root_, new_order);
+            current_ = nullptr;
         }
         
-        // 순회 재시작
+        // 순회 재시작 - 버퍼 용량은 유지하므로 재순회 시 할당 없음
         void reset() {
-            // 스택/큐 초기화
-            while (!dfs_stack_.empty()) dfs_stack_.pop();
-            while (!bfs_queue_.empty()) bfs_queue_.pop();
-            
+            state_.restart(root_);
             current_ = nullptr;
-            
-            if (root_ && !root_->children().empty()) {
-                initialize_traversal();
-            }
-        }
-        
-    private:
-        void initialize_traversal() {
-            const auto& children = root_->children();
-            
-            switch (order_) {
-                case traversal_order::depth_first_preorder:
-                case traversal_order::depth_first_postorder:
-                    // 역순으로 스택에 push (첫 번째 자식이 먼저 나오도록)
-                    for (auto it = children.rbegin(); it != children.rend(); ++it) {
-                        dfs_stack_.push(&(*it));
-                    }
-                    break;
-                    
-                case traversal_order::breadth_first:
-                    // 순서대로 큐에 push
-                    for (const auto& child : children) {
-                        bfs_queue_.push(&child);
-                    }
-                    break;
-            }
-        }
-        
-        const variant_type& next_dfs_preorder() {
-            current_ = dfs_stack_.top();
-            dfs_stack_.pop();
-            
-            // 현재 노드가 composite인 경우 자식들을 스택에 추가
-            std::visit([this](const auto& node) {
-                if constexpr (requires { node.children(); }) {
-                    const auto& children = node.children();
-                    for (auto it = children.rbegin(); it != children.rend(); ++it) {
-                        dfs_stack_.push(&(*it));
-                    }
-                }
-            }, *current_);
-            
-            return *current_;
-        }
-        
-        const variant_type& next_dfs_postorder() {
-            // 후위 순회는 더 복잡한 구현 필요
-            // 단순화된 구현
-            return next_dfs_preorder();
-        }
-        
-        const variant_type& next_bfs() {
-            current_ = bfs_queue_.front();
-            bfs_queue_.pop();
-            
-            // 현재 노드가 composite인 경우 자식들을 큐에 추가
-            std::visit([this](const auto& node) {
-                if constexpr (requires { node.children(); }) {
-                    const auto& children = node.children();
-                    for (const auto& child : children) {
-                        bfs_queue_.push(&child);
-                    }
-                }
-            }, *current_);
-            
-            return *current_;
         }
     };
     
+    // 기본 인라인 용량 composite<ComponentTypes...> 의 순회기
+    template<Component... ComponentTypes>
+    using tree_iterator = basic_tree_iterator<composite<ComponentTypes...>>;
+    
     /**
      * @brief 검색 결과 [7] "Aggregate" 인터페이스 스타일
      */
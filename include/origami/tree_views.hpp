@@ -0,0 +1,208 @@
+/**
+ * @file include/origami/tree_views.hpp
+ * @brief composite 트리용 std::ranges 지연(lazy) view 어댑터
+ * @details tree_iterator::collect 처럼 중간 벡터를 만들지 않고,
+ *          tree | views::leaves_of<int_leaf> | std::views::take(100) 처럼 조합하면
+ *          필요한 만큼만 순회하고 멈춘다.
+ */
+
+#pragma once
+
+#include <origami/tree_iterator.hpp>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+namespace metaloki::origami {
+
+    namespace detail {
+        template<typename Composite>
+        struct traversal_of;
+
+        template<std::size_t InlineChildren, Component... ChildTypes>
+        struct traversal_of<basic_composite<InlineChildren, ChildTypes...>> {
+            using type = basic_tree_iterator<basic_composite<InlineChildren, ChildTypes...>>;
+        };
+
+        template<typename Tree>
+        using traversal_t = typename traversal_of<composite_base_t<Tree>>::type;
+    }
+
+    /**
+     * @brief 트리 전체를 지정한 순서로 순회하는 view
+     * @details 트리를 포인터로만 참조하므로 O(1) 복사되며, iterator 는 view 가 아닌
+     *          트리를 가리키므로 borrowed range 이다.
+     */
+    template<typename Composite>
+    class traversal_view : public std::ranges::view_interface<traversal_view<Composite>> {
+    public:
+        using traversal = detail::traversal_t<Composite>;
+        using iterator = typename traversal::iterator;
+
+    private:
+        const Composite* root_ = nullptr;
+        traversal_order order_ = traversal_order::depth_first_preorder;
+
+    public:
+        traversal_view() = default;
+
+        traversal_view(const Composite& root, traversal_order order) : root_(&root), order_(order) {}
+
+        iterator begin() const { return iterator(root_, order_); }
+        iterator end() const { return iterator(); }
+    };
+
+    /**
+     * @brief (노드, 깊이) 쌍을 반환하는 view
+     */
+    template<typename Composite>
+    class depth_view : public std::ranges::view_interface<depth_view<Composite>> {
+    public:
+        using traversal = detail::traversal_t<Composite>;
+        using variant_type = typename traversal::variant_type;
+
+        // 구조적 바인딩 지원: auto [node, depth] = entry;
+        struct entry {
+            const variant_type& node;
+            std::size_t depth;
+        };
+
+        class iterator {
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = entry;
+            using reference = entry;
+
+        private:
+            typename traversal::iterator base_;
+
+        public:
+            iterator() = default;
+            explicit iterator(typename traversal::iterator base) : base_(std::move(base)) {}
+
+            reference operator*() const { return {*base_, base_.depth()}; }
+
+            iterator& operator++() {
+                ++base_;
+                return *this;
+            }
+
+            iterator operator++(int) {
+                iterator tmp = *this;
+                ++base_;
+                return tmp;
+            }
+
+            bool operator==(const iterator& other) const { return base_ == other.base_; }
+        };
+
+    private:
+        const Composite* root_ = nullptr;
+        traversal_order order_ = traversal_order::depth_first_preorder;
+
+    public:
+        depth_view() = default;
+
+        depth_view(const Composite& root, traversal_order order) : root_(&root), order_(order) {}
+
+        iterator begin() const { return iterator(typename traversal::iterator(root_, order_)); }
+        iterator end() const { return iterator(); }
+    };
+}
+
+template<typename Composite>
+inline constexpr bool std::ranges::enable_borrowed_range<metaloki::origami::traversal_view<Composite>> = true;
+
+template<typename Composite>
+inline constexpr bool std::ranges::enable_borrowed_range<metaloki::origami::depth_view<Composite>> = true;
+
+namespace metaloki::origami::views {
+
+    namespace detail {
+        using origami::detail::composite_tree;
+        using origami::detail::traversal_t;
+
+        /**
+         * @brief composite 를 왼쪽 피연산자로 받는 파이프 어댑터 기반
+         * @details composite 자체는 range 가 아니므로 tree | views::dfs 를 직접 지원한다.
+         *          임시 트리에 대한 view 는 dangling 되므로 rvalue 는 거부한다.
+         */
+        template<typename Derived>
+        struct tree_adaptor {
+            template<composite_tree Tree>
+            friend auto operator|(const Tree& tree, const Derived& adaptor) {
+                return adaptor(tree);
+            }
+
+            template<composite_tree Tree>
+            friend auto operator|(const Tree&& tree, const Derived& adaptor) = delete;
+        };
+
+        template<traversal_order Order>
+        struct traversal_fn : tree_adaptor<traversal_fn<Order>> {
+            template<composite_tree Tree>
+            auto operator()(const Tree& tree) const {
+                using traversal = traversal_t<Tree>;
+                using composite_type = typename traversal::composite_type;
+                return traversal_view<composite_type>(tree, Order);
+            }
+
+            template<composite_tree Tree>
+            void operator()(const Tree&& tree) const = delete;
+        };
+
+        struct with_depth_fn : tree_adaptor<with_depth_fn> {
+            template<composite_tree Tree>
+            auto operator()(const Tree& tree) const {
+                using traversal = traversal_t<Tree>;
+                using composite_type = typename traversal::composite_type;
+                return depth_view<composite_type>(tree, traversal_order::depth_first_preorder);
+            }
+
+            // 순서를 지정하는 버전 - views::with_depth(tree, order)
+            template<composite_tree Tree>
+            auto operator()(const Tree& tree, traversal_order order) const {
+                using composite_type = typename traversal_t<Tree>::composite_type;
+                return depth_view<composite_type>(tree, order);
+            }
+
+            template<composite_tree Tree>
+            void operator()(const Tree&& tree) const = delete;
+        };
+
+        template<typename Element>
+        struct leaves_of_fn : tree_adaptor<leaves_of_fn<Element>> {
+            template<composite_tree Tree>
+            auto operator()(const Tree& tree) const {
+                using traversal = traversal_t<Tree>;
+                using variant_type = typename traversal::variant_type;
+                using composite_type = typename traversal::composite_type;
+
+                return traversal_view<composite_type>(tree, traversal_order::depth_first_preorder)
+                    | std::views::filter([](const variant_type& node) {
+                          return std::holds_alternative<Element>(node);
+                      })
+                    | std::views::transform([](const variant_type& node) -> const Element& {
+                          return *std::get_if<Element>(&node);
+                      });
+            }
+
+            template<composite_tree Tree>
+            void operator()(const Tree&& tree) const = delete;
+        };
+    }
+
+    // 전위 DFS view
+    inline constexpr detail::traversal_fn<traversal_order::depth_first_preorder> dfs{};
+
+    // 레벨 순회 view
+    inline constexpr detail::traversal_fn<traversal_order::breadth_first> bfs{};
+
+    // (노드, 깊이) view
+    inline constexpr detail::with_depth_fn with_depth{};
+
+    // 특정 타입 노드만 const Element& 로 반환하는 view
+    template<typename Element>
+    inline constexpr detail::leaves_of_fn<Element> leaves_of{};
+}
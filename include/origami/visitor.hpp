@@ -19,10 +19,18 @@ namespace metaloki::origami {
      * @brief 검색 결과 [4] "Visitor 인터페이스" 현대화
      * @details C++20 concepts 기반 Visitor 개념
      */
+    namespace detail {
+        // 모든 요소를 받는 visitor - Visitable 검사에서 accept_visitor 의 인자로만 쓴다
+        template<typename ResultType>
+        struct visitor_probe {
+            template<typename ElementType>
+            ResultType visit(const ElementType&);
+        };
+    }
+    
     template<typename T>
-    concept Visitable = requires(T t) {
-        typename T::visitor_result_type;
-        { t.accept_visitor(std::declval<auto>()) } -> std::same_as<typename T::visitor_result_type>;
+    concept Visitable = requires(const T& t, detail::visitor_probe<typename T::visitor_result_type>& visitor) {
+        { t.accept_visitor(visitor) } -> std::same_as<typename T::visitor_result_type>;
     };
     
     template<typename V, typename... ElementTypes>
@@ -103,18 +111,10 @@ namespace metaloki::origami {
         }
         
         // 검색 결과 [4] "아닐 경우 accept 를 하여 visit 를 허용"
-        template<Component... ComponentTypes>
-        result_type visit(const composite<ComponentTypes...>& composite_element) {
-            // 모든 자식에 대해 재귀적으로 방문
-            for (const auto& child : composite_element.children()) {
-                std::visit([this](const auto& child_element) {
-                    if constexpr (requires { child_element.accept_visitor(*this); }) {
-                        child_element.accept_visitor(*this);
-                    } else {
-                        this->visit(child_element);
-                    }
-                }, child);
-            }
+        // 서브트리 합은 composite 에 캐시되므로 변경이 없으면 재방문 없이 O(1)
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
+            accumulated_value_ += composite_element.template aggregate<aggregates::sum<ValueType>>();
             return accumulated_value_;
         }
         
@@ -141,17 +141,10 @@ namespace metaloki::origami {
             return static_cast<double>(sum_) / count_;
         }
         
-        template<Component... ComponentTypes>
-        result_type visit(const composite<ComponentTypes...>& composite_element) {
-            for (const auto& child : composite_element.children()) {
-                std::visit([this](const auto& child_element) {
-                    if constexpr (requires { child_element.accept_visitor(*this); }) {
-                        child_element.accept_visitor(*this);
-                    } else {
-                        this->visit(child_element);
-                    }
-                }, child);
-            }
+        template<std::size_t InlineChildren, Component... ComponentTypes>
+        result_type visit(const basic_composite<InlineChildren, ComponentTypes...>& composite_element) {
+            sum_ += composite_element.template aggregate<aggregates::sum<ValueType>>();
+            count_ += composite_element.template aggregate<aggregates::count_of<leaf<ValueType>>>();
             return count_ > 0 ? static_cast<double>(sum_) / count_ : 0.0;
         }
         
@@ -9,7 +9,17 @@
 #include <origami/visitor.hpp>
 #include <origami/builder.hpp>
 #include <origami/advanced_builder.hpp>
+#include <origami/optimized_patterns.hpp>
+#include <origami/origami_composite.hpp>
+#include <origami/graph_algorithms.hpp>
+#include <origami/parallel_graph.hpp>
+#include <origami/graph_ordering.hpp>
+#include <origami/edge_attributes.hpp>
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include <random>
+#include <span>
 #include <vector>
 
 using namespace metaloki::origami;
@@ -64,6 +74,600 @@ static void BM_CompositeCreation(benchmark::State& state) {
 }
 BENCHMARK(BM_CompositeCreation)->Range(8, 8<<10)->Complexity();
 
+// 인라인 자식 저장소 비교용 - false 면 자식을 항상 힙에 두는 composite
+template<bool InlineChildren, typename... ChildTypes>
+using bench_composite = std::conditional_t<InlineChildren,
+    composite<ChildTypes...>, basic_composite<0, ChildTypes...>>;
+
+// 깊고 좁은 트리 생성 - 노드마다 자식 2개, 4단계 중첩
+template<bool InlineChildren>
+static void BM_CompositeCreationDeepNarrow(benchmark::State& state) {
+    using level3 = bench_composite<InlineChildren, int_leaf>;
+    using level2 = bench_composite<InlineChildren, level3, int_leaf>;
+    using level1 = bench_composite<InlineChildren, level2, int_leaf>;
+    using root_type = bench_composite<InlineChildren, level1>;
+    
+    const size_t num_subtrees = state.range(0);
+    
+    for (auto _ : state) {
+        root_type document("Deep Doc");
+        
+        for (size_t i = 0; i < num_subtrees; ++i) {
+            level3 cells("Cell");
+            cells.add(int_leaf(data_gen.generate_int()));
+            cells.add(int_leaf(data_gen.generate_int()));
+            
+            level2 row("Row");
+            row.add(std::move(cells));
+            row.add(int_leaf(data_gen.generate_int()));
+            
+            level1 section("Section");
+            section.add(std::move(row));
+            section.add(int_leaf(data_gen.generate_int()));
+            
+            document.add(std::move(section));
+        }
+        
+        benchmark::DoNotOptimize(document);
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_CompositeCreationDeepNarrow, false)->Range(8, 8<<10)->Complexity();
+BENCHMARK_TEMPLATE(BM_CompositeCreationDeepNarrow, true)->Range(8, 8<<10)->Complexity();
+
+// 일괄 삽입 비교용 - 이미 자식이 있는 composite 에 num_elements 개를 붙인다
+using bulk_composite = composite<int_leaf>;
+
+static bulk_composite make_bulk_target(size_t existing) {
+    bulk_composite target("Target");
+    for (size_t i = 0; i < existing; ++i) target.add(int_leaf(static_cast<int>(i)));
+    return target;
+}
+
+// 끝에 추가 - 반복 add 대 append_range
+template<bool Bulk>
+static void BM_CompositeAppend(benchmark::State& state) {
+    const size_t num_elements = state.range(0);
+    std::vector<int_leaf> batch;
+    for (size_t i = 0; i < num_elements; ++i) batch.emplace_back(data_gen.generate_int());
+    
+    for (auto _ : state) {
+        bulk_composite target = make_bulk_target(16);
+        if constexpr (Bulk) {
+            target.append_range(batch);
+        } else {
+            for (const auto& element : batch) target.add_copy(element);
+        }
+        benchmark::DoNotOptimize(target);
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_CompositeAppend, false)->Range(8, 8<<10)->Complexity();
+BENCHMARK_TEMPLATE(BM_CompositeAppend, true)->Range(8, 8<<10)->Complexity();
+
+// 중간 삽입 - 한 개씩 insert_range 대 한 번의 insert_range
+template<bool Bulk>
+static void BM_CompositeInsertMiddle(benchmark::State& state) {
+    const size_t num_elements = state.range(0);
+    std::vector<int_leaf> batch;
+    for (size_t i = 0; i < num_elements; ++i) batch.emplace_back(data_gen.generate_int());
+    
+    for (auto _ : state) {
+        bulk_composite target = make_bulk_target(num_elements);
+        const size_t middle = num_elements / 2;
+        if constexpr (Bulk) {
+            target.insert_range(middle, batch);
+        } else {
+            for (size_t i = 0; i < batch.size(); ++i) {
+                target.insert_range(middle + i, std::span<const int_leaf>(&batch[i], 1));
+            }
+        }
+        benchmark::DoNotOptimize(target);
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_CompositeInsertMiddle, false)->Range(8, 8<<10)->Complexity();
+BENCHMARK_TEMPLATE(BM_CompositeInsertMiddle, true)->Range(8, 8<<10)->Complexity();
+
+// 다른 composite 의 자식 이동 - 하나씩 add 후 erase 대 splice
+template<bool Bulk>
+static void BM_CompositeSplice(benchmark::State& state) {
+    const size_t num_elements = state.range(0);
+    
+    for (auto _ : state) {
+        state.PauseTiming();
+        bulk_composite source = make_bulk_target(num_elements);
+        bulk_composite target = make_bulk_target(16);
+        state.ResumeTiming();
+        
+        if constexpr (Bulk) {
+            target.splice(8, source);
+        } else {
+            for (size_t i = 0; i < num_elements; ++i) {
+                target.add(std::move(std::get<int_leaf>(source.children()[i])));
+            }
+            source.erase_range(0, num_elements);
+        }
+        benchmark::DoNotOptimize(target);
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_CompositeSplice, false)->Range(8, 8<<10)->Complexity();
+BENCHMARK_TEMPLATE(BM_CompositeSplice, true)->Range(8, 8<<10)->Complexity();
+
+// 혼합 자식 합산 - composite 는 요소마다 variant 분기, fast_composite 는 파티션별 단일 타입 루프
+using mixed_composite = composite<int_leaf, string_leaf>;
+using mixed_fast_composite = optimized::fast_composite<int_leaf, string_leaf>;
+
+static mixed_composite make_mixed_composite(size_t num_elements) {
+    mixed_composite document("Mixed");
+    document.reserve(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        if (i % 4 == 3) {
+            document.add(string_leaf(data_gen.generate_string()));
+        } else {
+            document.add(int_leaf(data_gen.generate_int()));
+        }
+    }
+    return document;
+}
+
+static void BM_MixedSumComposite(benchmark::State& state) {
+    const mixed_composite document = make_mixed_composite(state.range(0));
+    
+    for (auto _ : state) {
+        long long sum = 0;
+        for (const auto& child : document.children()) {
+            std::visit([&sum](const auto& element) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(element)>, int_leaf>) sum += element.value();
+            }, child);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_MixedSumComposite)->Range(8, 8<<12)->Complexity();
+
+static void BM_MixedSumFastComposite(benchmark::State& state) {
+    const auto document = mixed_fast_composite::from(make_mixed_composite(state.range(0)));
+    const optimized::fast_iterator<int_leaf, string_leaf> iterator;
+    
+    for (auto _ : state) {
+        const long long sum = iterator.fast_reduce<int_leaf>(document, 0LL, std::plus<>{},
+            [](const int_leaf& element) { return element.value(); });
+        benchmark::DoNotOptimize(sum);
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_MixedSumFastComposite)->Range(8, 8<<12)->Complexity();
+
+// 보고서형 합계 - 트리 순회로 variant 를 하나씩 푸는 것과 leaf 값 열을 훑는 것 비교
+using double_leaf = leaf<double>;
+using report_row = composite<int_leaf, double_leaf>;
+using report_table = composite<report_row>;
+
+static report_table make_report_table(size_t num_rows) {
+    report_table table("Report");
+    table.reserve(num_rows);
+    for (size_t r = 0; r < num_rows; ++r) {
+        report_row row("Row");
+        for (int c = 0; c < 8; ++c) {
+            row.add(int_leaf(data_gen.generate_int()));
+            row.add(double_leaf(static_cast<double>(c)));
+        }
+        table.add(std::move(row));
+    }
+    return table;
+}
+
+static void BM_ReportSumTraverse(benchmark::State& state) {
+    const report_table table = make_report_table(state.range(0));
+    
+    for (auto _ : state) {
+        long long sum = 0;
+        table.traverse([&sum](const auto& node) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(node)>, int_leaf>) sum += node.value();
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ReportSumTraverse)->Range(8, 8<<10)->Complexity();
+
+static void BM_ReportSumColumn(benchmark::State& state) {
+    const report_table table = make_report_table(state.range(0));
+    table.column<int>();  // 색인은 한 번 만들고 질의마다 재사용
+    
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.column<int>().sum());
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ReportSumColumn)->Range(8, 8<<10)->Complexity();
+
+// Miura 격자 생성 - 간선마다 connect (잠금 + 검증) 대 좌표 산술로 한 번에
+using miura_pattern = origami_composite<int>;
+
+static void BM_MiuraGenerationPerEdge(benchmark::State& state) {
+    const size_t side = state.range(0);
+    
+    for (auto _ : state) {
+        miura_pattern pattern;
+        for (size_t i = 0; i < side * side; ++i) pattern.add_element();
+        miura_lattice(side, side).for_each_edge([&](size_t fx, size_t fy, size_t tx, size_t ty) {
+            pattern.connect(fy * side + fx, ty * side + tx);
+            pattern.connect(ty * side + tx, fy * side + fx);
+        });
+        benchmark::DoNotOptimize(pattern);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_MiuraGenerationPerEdge)->Range(8, 512)->Complexity();
+
+static void BM_MiuraGeneration(benchmark::State& state) {
+    const size_t side = state.range(0);
+    
+    for (auto _ : state) {
+        miura_pattern pattern;
+        pattern.create_miura_pattern(side, side);
+        benchmark::DoNotOptimize(pattern);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_MiuraGeneration)->Range(8, 512)->Complexity();
+
+// 10k x 10k 격자에서 창 하나만 생성 - 비용은 창 크기에만 비례
+static void BM_MiuraTile(benchmark::State& state) {
+    const miura_lattice lattice(10000, 10000);
+    const size_t side = state.range(0);
+    
+    for (auto _ : state) {
+        miura_pattern pattern;
+        pattern.create_miura_tile(lattice, {5000, 5000, side, side});
+        benchmark::DoNotOptimize(pattern);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_MiuraTile)->Range(8, 512)->Complexity();
+
+// 암시적 격자 - 연결 목록 없이 노드만 생성
+static void BM_MiuraImplicitGeneration(benchmark::State& state) {
+    const size_t side = state.range(0);
+    
+    for (auto _ : state) {
+        miura_pattern pattern;
+        pattern.create_implicit_miura_pattern(side, side);
+        benchmark::DoNotOptimize(pattern);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_MiuraImplicitGeneration)->Range(8, 512)->Complexity();
+
+// 모든 노드의 연결 방문 - 저장된 목록 대 좌표 계산
+template<bool Implicit>
+static void BM_MiuraVisitConnections(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern;
+    if constexpr (Implicit) {
+        pattern.create_implicit_miura_pattern(side, side);
+    } else {
+        pattern.create_miura_pattern(side, side);
+    }
+    
+    for (auto _ : state) {
+        size_t checksum = 0;
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            pattern.visit_connections(i, [&checksum](size_t, size_t to, const int&, const int&) { checksum += to; });
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_MiuraVisitConnections, false)->Range(8, 512)->Complexity();
+BENCHMARK_TEMPLATE(BM_MiuraVisitConnections, true)->Range(8, 512)->Complexity();
+
+// 무방향 저장 - 접힘선마다 연결 항목 하나
+static void BM_MiuraGenerationUndirected(benchmark::State& state) {
+    const size_t side = state.range(0);
+    
+    for (auto _ : state) {
+        miura_pattern pattern("Miura-ori", edge_options{edge_mode::undirected, false});
+        pattern.create_miura_pattern(side, side);
+        benchmark::DoNotOptimize(pattern);
+    }
+    
+    state.counters["stored_edges"] = static_cast<double>(miura_lattice(side, side).edge_count());
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_MiuraGenerationUndirected)->Range(8, 512)->Complexity();
+
+// 무방향 패턴의 양방향 방문 (역방향 색인) 대 접힘선 한 번씩 방문
+template<bool Symmetric>
+static void BM_MiuraUndirectedVisit(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern("Miura-ori", edge_options{edge_mode::undirected, false});
+    pattern.create_miura_pattern(side, side);
+    
+    for (auto _ : state) {
+        size_t checksum = 0;
+        if constexpr (Symmetric) {
+            for (size_t i = 0; i < pattern.size(); ++i) {
+                pattern.visit_connections(i, [&checksum](size_t, size_t to, const int&, const int&) { checksum += to; });
+            }
+        } else {
+            pattern.for_each_edge([&checksum](size_t from, size_t to, const int&, const int&) { checksum += from + to; });
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_MiuraUndirectedVisit, true)->Range(8, 512)->Complexity();
+BENCHMARK_TEMPLATE(BM_MiuraUndirectedVisit, false)->Range(8, 512)->Complexity();
+
+// 상주 연결 메모리 - 무방향은 저장 항목이 절반이지만 첫 방문 때 역방향 색인이 생긴다
+template<edge_mode Mode>
+static void BM_MiuraEdgeMemory(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern("Miura-ori", edge_options{Mode, false});
+    pattern.create_miura_pattern(side, side);
+    const size_t before_visit = pattern.edge_memory();
+    
+    for (auto _ : state) {
+        size_t checksum = 0;
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            pattern.visit_connections(i, [&checksum](size_t, size_t to, const int&, const int&) { checksum += to; });
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    
+    const double creases = static_cast<double>(miura_lattice(side, side).edge_count());
+    state.counters["stored_bytes_per_crease"] = static_cast<double>(before_visit) / creases;
+    state.counters["resident_bytes_per_crease"] = static_cast<double>(pattern.edge_memory()) / creases;
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_MiuraEdgeMemory, edge_mode::directed)->Range(64, 512)->Complexity();
+BENCHMARK_TEMPLATE(BM_MiuraEdgeMemory, edge_mode::undirected)->Range(64, 512)->Complexity();
+
+// 중복 검사 연결 - 정렬된 연결 목록 이진 탐색
+template<bool Unique>
+static void BM_ConnectRepeated(benchmark::State& state) {
+    const size_t count = state.range(0);
+    
+    for (auto _ : state) {
+        miura_pattern pattern("Hub", edge_options{edge_mode::undirected, Unique});
+        for (size_t i = 0; i < count; ++i) pattern.add_element(static_cast<int>(i));
+        // 같은 허브 연결을 세 번씩 요청
+        for (int round = 0; round < 3; ++round) {
+            for (size_t i = 1; i < count; ++i) pattern.connect(0, (i * 7919) % count);
+        }
+        benchmark::DoNotOptimize(pattern);
+    }
+    
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ConnectRepeated, false)->Range(8, 8<<10)->Complexity();
+BENCHMARK_TEMPLATE(BM_ConnectRepeated, true)->Range(8, 8<<10)->Complexity();
+
+// 접힘선 그래프 BFS - 작업 버퍼 재사용, 항상 top-down
+static void BM_GraphBFS(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern;
+    pattern.create_implicit_miura_pattern(side, side);
+    const auto crease = graph::crease_graph::from(pattern);
+    graph::graph_workspace workspace;
+    
+    for (auto _ : state) {
+        std::uint32_t deepest = 0;
+        graph::breadth_first_search(crease, 0, [&deepest](graph::vertex, std::uint32_t depth) { deepest = depth; }, workspace);
+        benchmark::DoNotOptimize(deepest);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_GraphBFS)->Range(8, 512)->Complexity();
+
+// 방향 최적화 BFS - 프론티어가 넓을 때 bottom-up
+static void BM_GraphDirectionOptimizingBFS(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern;
+    pattern.create_implicit_miura_pattern(side, side);
+    const auto crease = graph::crease_graph::from(pattern);
+    
+    for (auto _ : state) {
+        auto depths = graph::direction_optimizing_bfs(crease, static_cast<graph::vertex>(crease.node_count() / 2));
+        benchmark::DoNotOptimize(depths.data());
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_GraphDirectionOptimizingBFS)->Range(8, 512)->Complexity();
+
+// 정수 가중치 Dijkstra (radix heap)
+static void BM_GraphDijkstra(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern;
+    pattern.create_implicit_miura_pattern(side, side);
+    const auto crease = graph::crease_graph::from(pattern);
+    
+    for (auto _ : state) {
+        auto paths = graph::dijkstra<std::uint32_t>(crease, 0, [](graph::vertex from, graph::vertex to) {
+            return (from ^ to) % 7 + 1;
+        });
+        benchmark::DoNotOptimize(paths.distance.data());
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_GraphDijkstra)->Range(8, 512)->Complexity();
+
+// 레벨 동기 병렬 BFS (공용 풀)
+static void BM_GraphParallelBFS(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern;
+    pattern.create_implicit_miura_pattern(side, side);
+    const auto crease = graph::crease_graph::from(pattern);
+    
+    for (auto _ : state) {
+        auto depths = graph::parallel_bfs(crease, static_cast<graph::vertex>(crease.node_count() / 2));
+        benchmark::DoNotOptimize(depths.data());
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_GraphParallelBFS)->Range(8, 1024)->Complexity();
+
+// 연결 요소 - 직렬 union-find 대 병렬 라벨 전파
+template<bool Parallel>
+static void BM_GraphComponents(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern;
+    pattern.create_implicit_miura_pattern(side, side);
+    const auto crease = graph::crease_graph::from(pattern);
+    
+    for (auto _ : state) {
+        auto labels = Parallel ? graph::parallel_connected_components(crease) : graph::connected_components(crease);
+        benchmark::DoNotOptimize(labels.label.data());
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_GraphComponents, false)->Range(8, 1024)->Complexity();
+BENCHMARK_TEMPLATE(BM_GraphComponents, true)->Range(8, 1024)->Complexity();
+
+// 노드 번호 순서 - 0: 무작위(사용자 임의 생성), 1: 역 Cuthill-McKee, 2: Hilbert
+static miura_pattern make_ordered_pattern(size_t side, int ordering) {
+    miura_pattern pattern;
+    pattern.create_miura_pattern(side, side);
+    
+    std::vector<size_t> shuffled(pattern.size());
+    std::iota(shuffled.begin(), shuffled.end(), size_t{0});
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937{7});
+    
+    if (ordering == 2) {
+        // 격자 좌표가 필요하므로 섞기 전 행 우선 번호에서 Hilbert 순서로
+        pattern.reorder(graph::hilbert_order(miura_lattice(side, side)));
+        return pattern;
+    }
+    pattern.reorder(shuffled);
+    if (ordering == 1) {
+        pattern.reorder(graph::reverse_cuthill_mckee(graph::crease_graph::from(pattern)));
+    }
+    return pattern;
+}
+
+// 모든 노드에서 이웃 요소 합 - 노드 배열 임의 접근
+template<int Ordering>
+static void BM_GraphOrderingNeighborSum(benchmark::State& state) {
+    const auto pattern = make_ordered_pattern(state.range(0), Ordering);
+    
+    for (auto _ : state) {
+        long long sum = 0;
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            pattern.visit_connections(i, [&sum](size_t, size_t, const int&, const int& to) { sum += to; });
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_GraphOrderingNeighborSum, 0)->Range(64, 1024)->Complexity();
+BENCHMARK_TEMPLATE(BM_GraphOrderingNeighborSum, 1)->Range(64, 1024)->Complexity();
+BENCHMARK_TEMPLATE(BM_GraphOrderingNeighborSum, 2)->Range(64, 1024)->Complexity();
+
+// 재배치한 패턴의 CSR BFS
+template<int Ordering>
+static void BM_GraphOrderingBFS(benchmark::State& state) {
+    const auto crease = graph::crease_graph::from(make_ordered_pattern(state.range(0), Ordering));
+    graph::graph_workspace workspace;
+    
+    for (auto _ : state) {
+        std::uint32_t deepest = 0;
+        graph::breadth_first_search(crease, 0, [&deepest](graph::vertex, std::uint32_t depth) { deepest = depth; }, workspace);
+        benchmark::DoNotOptimize(deepest);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_GraphOrderingBFS, 0)->Range(64, 1024)->Complexity();
+BENCHMARK_TEMPLATE(BM_GraphOrderingBFS, 1)->Range(64, 1024)->Complexity();
+BENCHMARK_TEMPLATE(BM_GraphOrderingBFS, 2)->Range(64, 1024)->Complexity();
+
+// 접힘선 데이터 - 노드별 구조체 목록(AoS) 대 접힘선 번호 순 속성 열(SoA)
+struct crease_record {
+    size_t target;
+    double angle;
+    double stiffness;
+    std::uint8_t kind;
+};
+
+// 접힘 에너지 합 sum(k * (angle - rest)^2) - 구조체를 따라가는 방식
+static void BM_CreaseEnergyRecords(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern;
+    pattern.create_implicit_miura_pattern(side, side);
+    
+    std::vector<std::vector<crease_record>> records(pattern.size());
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        pattern.visit_connections(i, [&records](size_t from, size_t to, const int&, const int&) {
+            records[from].push_back({to, 0.01 * static_cast<double>(to % 97), 1.0 + static_cast<double>(from % 5), 0});
+        });
+    }
+    
+    for (auto _ : state) {
+        double energy = 0.0;
+        for (const auto& creases : records) {
+            for (const auto& crease : creases) {
+                const double delta = crease.angle - 0.5;
+                energy += crease.stiffness * delta * delta;
+            }
+        }
+        benchmark::DoNotOptimize(energy);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_CreaseEnergyRecords)->Range(64, 1024)->Complexity();
+
+// 같은 커널 - 각도/강성 열만 순서대로, 접힘선마다 한 행
+static void BM_CreaseEnergyColumns(benchmark::State& state) {
+    const size_t side = state.range(0);
+    miura_pattern pattern("Creases", edge_options{edge_mode::undirected, false});
+    pattern.create_implicit_miura_pattern(side, side);
+    const auto crease = graph::crease_graph::from(pattern);
+    const auto attributes = graph::edge_attributes<std::uint8_t, double, double>::from(crease,
+        [](graph::vertex from, graph::vertex to, size_t) {
+            return std::tuple{std::uint8_t{0}, 0.01 * static_cast<double>(to % 97), 1.0 + static_cast<double>(from % 5)};
+        });
+    
+    for (auto _ : state) {
+        const auto angle = attributes.column<1>();
+        const auto stiffness = attributes.column<2>();
+        double energy = 0.0;
+        for (size_t e = 0; e < angle.size(); ++e) {
+            const double delta = angle[e] - 0.5;
+            energy += stiffness[e] * delta * delta;
+        }
+        benchmark::DoNotOptimize(energy);
+    }
+    
+    state.SetComplexityN(state.range(0) * state.range(0));
+}
+BENCHMARK(BM_CreaseEnergyColumns)->Range(64, 1024)->Complexity();
+
 // Builder 성능 벤치마크
 static void BM_BuilderConstruction(benchmark::State& state) {
     const size_t num_components = state.range(0);
@@ -0,0 +1,49 @@
+/**
+ * @file tests/unit/section_fixture.hpp
+ * @brief 단위 테스트 공용 섹션 노드 - 동일 variant 로 재귀하는 비-composite 컴포넌트
+ * @details 순회/뷰/렌더러 테스트가 같은 정의를 쓰도록 한 곳에 둔다. 트리 모양은 각 테스트가 만든다.
+ */
+
+#pragma once
+
+#include <origami/composite.hpp>
+#include <memory>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace origami_test {
+
+    /**
+     * @brief children() 로 Leaves... 와 자기 자신을 담는 섹션
+     * @details 깊은 체인을 만드는 테스트를 위해 소멸도 반복으로 처리한다
+     */
+    template<typename... Leaves>
+    struct basic_section : metaloki::origami::component_base<basic_section<Leaves...>> {
+        using node_variant = std::variant<Leaves..., basic_section>;
+
+        std::vector<node_variant> items;
+
+        basic_section() = default;
+        basic_section(const basic_section&) = default;
+        basic_section(basic_section&&) noexcept = default;
+        basic_section& operator=(const basic_section&) = default;
+        basic_section& operator=(basic_section&&) noexcept = default;
+
+        ~basic_section() {
+            std::vector<node_variant> pending = std::move(items);
+            while (!pending.empty()) {
+                node_variant node = std::move(pending.back());
+                pending.pop_back();
+                if (auto* nested = std::get_if<basic_section>(&node)) {
+                    for (auto& child : nested->items) pending.push_back(std::move(child));
+                    nested->items.clear();
+                }
+            }
+        }
+
+        const std::vector<node_variant>& children() const { return items; }
+        void render_impl() const {}
+        std::unique_ptr<basic_section> clone_impl() const { return std::make_unique<basic_section>(*this); }
+    };
+}
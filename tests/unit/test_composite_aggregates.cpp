@@ -0,0 +1,161 @@
+/**
+ * @file tests/unit/test_composite_aggregates.cpp
+ * @brief composite 서브트리 집계 캐시 및 dirty 비트 전파 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/composite.hpp>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using chapter = composite<int_leaf>;
+
+struct section;
+using node_variant = std::variant<int_leaf, chapter, section>;
+
+struct section : component_base<section> {
+    std::vector<node_variant> items;
+
+    const std::vector<node_variant>& children() const { return items; }
+    void render_impl() const {}
+    std::unique_ptr<section> clone_impl() const { return std::make_unique<section>(*this); }
+};
+
+using book = composite<int_leaf, chapter, section>;
+using library = composite<int_leaf, book>;
+
+// lift 호출 횟수로 재계산 범위를 확인하는 합계 집계
+struct counted_sum {
+    using value_type = long;
+
+    static inline size_t lifts = 0;
+
+    static value_type identity() { return 0; }
+    static value_type combine(value_type a, value_type b) { return a + b; }
+
+    template<typename Node>
+    static value_type lift(const Node& node, value_type children) {
+        ++lifts;
+        if constexpr (std::is_same_v<Node, int_leaf>) {
+            return children + node.value();
+        } else {
+            return children;
+        }
+    }
+};
+
+static chapter make_chapter(int first, int count) {
+    chapter result("Chapter");
+    for (int i = 0; i < count; ++i) result.emplace<int_leaf>(first + i);
+    return result;
+}
+
+// book { 1, chapter{10..14}, section{ 2, section{ 3, chapter{20..22} } } }
+static book make_book() {
+    book result("Book");
+    result.emplace<int_leaf>(1);
+    result.add(make_chapter(10, 5));
+
+    section inner;
+    inner.items.push_back(int_leaf(3));
+    inner.items.push_back(make_chapter(20, 3));
+
+    section outer;
+    outer.items.push_back(int_leaf(2));
+    outer.items.push_back(std::move(inner));
+    result.add(std::move(outer));
+    return result;
+}
+
+TEST_SUITE("ORIGAMI composite aggregates") {
+
+    TEST_CASE("Built-in aggregates cover sections and nested composites") {
+        const auto tree = make_book();
+
+        // book, 1, chapter(+5), section, 2, section, 3, chapter(+3)
+        CHECK(tree.aggregate<aggregates::count>() == 16);
+        CHECK(tree.aggregate<aggregates::count_of<int_leaf>>() == 11);
+        CHECK(tree.aggregate<aggregates::sum<int>>() == 1 + 60 + 2 + 3 + 63);
+        CHECK(tree.aggregate<aggregates::max_depth>() == 5);  // book > section > section > chapter > leaf
+
+        const auto range = tree.aggregate<aggregates::min_max<int>>();
+        REQUIRE(range.has_value());
+        CHECK(range->min == 1);
+        CHECK(range->max == 22);
+
+        CHECK_FALSE(chapter("Empty").aggregate<aggregates::min_max<int>>().has_value());
+    }
+
+    TEST_CASE("Repeated queries are served from the cache") {
+        const auto tree = make_book();
+
+        counted_sum::lifts = 0;
+        const auto first = tree.aggregate<counted_sum>();
+        CHECK(counted_sum::lifts == 16);
+
+        counted_sum::lifts = 0;
+        CHECK(tree.aggregate<counted_sum>() == first);
+        CHECK(counted_sum::lifts == 0);
+    }
+
+    TEST_CASE("add on a nested composite invalidates only its ancestors") {
+        library shelf("Shelf");
+        for (int i = 0; i < 8; ++i) shelf.add(make_book());  // 재할당으로 book 들이 이동
+
+        auto& target = std::get<chapter>(std::get<book>(shelf.children()[3]).children()[1]);
+        const auto before = shelf.aggregate<counted_sum>();
+
+        counted_sum::lifts = 0;
+        target.emplace<int_leaf>(1000);
+        CHECK(shelf.aggregate<counted_sum>() == before + 1000);
+
+        // target chapter(7) + 해당 book 의 비-composite 노드(6) + shelf(1)
+        CHECK(counted_sum::lifts == 7 + 6 + 1);
+
+        CHECK(shelf.aggregate<aggregates::count>() == 1 + 8 * 16 + 1);
+    }
+
+    TEST_CASE("Mutable children access and moves keep the cache coherent") {
+        book tree = make_book();
+        CHECK(tree.aggregate<aggregates::sum<int>>() == 129);
+
+        std::get<int_leaf>(tree.children()[0]).value() = 101;
+        CHECK(tree.aggregate<aggregates::sum<int>>() == 229);
+
+        library shelf("Shelf");
+        shelf.add(std::move(tree));
+        CHECK(shelf.aggregate<aggregates::sum<int>>() == 229);
+
+        library moved = std::move(shelf);
+        auto& nested = std::get<chapter>(std::get<book>(moved.children()[0]).children()[1]);
+        CHECK(moved.aggregate<aggregates::sum<int>>() == 229);
+
+        nested.emplace<int_leaf>(1);
+        CHECK(moved.aggregate<aggregates::sum<int>>() == 230);
+
+        const library copy = moved;
+        CHECK(copy.aggregate<aggregates::max_depth>() == 6);
+    }
+
+    TEST_CASE("reserve relinks nested composites moved by the reallocation") {
+        library shelf("Shelf");
+        shelf.add(make_book());
+        shelf.add(make_book());
+
+        // book 의 자식은 힙에 있으므로 shelf 가 재할당해도 chapter 는 제자리에 남는다
+        auto& target = std::get<chapter>(std::get<book>(shelf.children()[1]).children()[1]);
+        const auto before = shelf.aggregate<aggregates::sum<int>>();
+        CHECK(before == 2 * 129);
+
+        shelf.reserve(64);
+        CHECK(shelf.aggregate<aggregates::sum<int>>() == before);
+
+        target.emplace<int_leaf>(1000);
+        CHECK(shelf.aggregate<aggregates::sum<int>>() == before + 1000);
+        CHECK(shelf.aggregate<aggregates::count>() == 1 + 2 * 16 + 1);
+    }
+}
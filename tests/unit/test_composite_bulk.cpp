@@ -0,0 +1,120 @@
+/**
+ * @file tests/unit/test_composite_bulk.cpp
+ * @brief composite 일괄 삽입 / splice / 구간 삭제 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/composite.hpp>
+#include <list>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using para = composite<int_leaf>;
+using section = composite<para, int_leaf>;
+
+static std::vector<int> values(const para& node) {
+    std::vector<int> result;
+    for (const auto& child : node.children()) result.push_back(std::get<int_leaf>(child).value());
+    return result;
+}
+
+TEST_SUITE("ORIGAMI composite bulk operations") {
+
+    TEST_CASE("append_range and insert_range accept sized and unsized ranges") {
+        para node("Para");
+        const std::vector<int_leaf> batch{int_leaf(1), int_leaf(2), int_leaf(3)};
+        node.append_range(batch);
+        node.append_range(std::vector<int_leaf>{int_leaf(9)});
+
+        const std::list<int_leaf> single{int_leaf(5)};
+        node.insert_range(1, single);
+
+        // 공통 범위가 아닌 뷰도 받는다
+        node.insert_range(0, std::views::iota(10, 12)
+                             | std::views::transform([](int value) { return int_leaf(value); }));
+        CHECK(values(node) == std::vector<int>{10, 11, 1, 5, 2, 3, 9});
+
+        // 인라인 용량을 넘는 일괄 삽입도 한 번에
+        para wide("Wide");
+        std::vector<int_leaf> many;
+        for (int i = 0; i < 100; ++i) many.emplace_back(i);
+        wide.reserve(4);
+        wide.append_range(std::move(many));
+        CHECK(wide.children().size() == 100);
+        CHECK(std::get<int_leaf>(wide.children()[99]).value() == 99);
+
+        CHECK_THROWS_AS(node.insert_range(8, batch), std::out_of_range);
+    }
+
+    TEST_CASE("splice moves a range of children between composites") {
+        para target("Target");
+        target.append_range(std::vector<int_leaf>{int_leaf(1), int_leaf(2)});
+        para source("Source");
+        source.append_range(std::vector<int_leaf>{int_leaf(100), int_leaf(200), int_leaf(300)});
+
+        target.splice(1, source, 0, 2);
+        CHECK(values(target) == std::vector<int>{1, 100, 200, 2});
+        CHECK(values(source) == std::vector<int>{300});
+
+        // 인라인 용량이 다른 composite 사이에서도
+        basic_composite<0, int_leaf> heap_only("Heap");
+        heap_only.splice(0, target);
+        CHECK(values(target).empty());
+        CHECK(heap_only.children().size() == 4);
+
+        CHECK_THROWS_AS(source.splice(0, source), std::invalid_argument);
+        CHECK_THROWS_AS(target.splice(0, source, 1, 3), std::out_of_range);
+        CHECK_THROWS_AS(target.splice(2, source, 0, 1), std::out_of_range);
+    }
+
+    TEST_CASE("Bulk operations keep cached subtree data consistent") {
+        section left("Left");
+        left.add(para("a"));
+        section right("Right");
+        para b("b");
+        b.emplace<int_leaf>(7);
+        right.add(std::move(b));
+        right.add(para("c"));
+
+        CHECK(left.subtree_size() == 2);
+        CHECK(right.find_child("b") == &right.children()[0]);
+
+        left.splice(1, right);
+        CHECK(left.subtree_size() == 5);
+        CHECK(right.subtree_size() == 1);
+        CHECK(left.subtree_size() == left.aggregate<aggregates::count>());
+        CHECK(right.find_child("b") == nullptr);
+        CHECK(left.find_child("c") == &left.children()[2]);
+
+        left.erase_range(0, 2);
+        CHECK(left.children().size() == 1);
+        CHECK(left.find_child("c") == &left.children()[0]);
+        CHECK(left.find_child("b") == nullptr);
+        CHECK_THROWS_AS(left.erase_range(1, 3), std::out_of_range);
+    }
+
+    TEST_CASE("Moves and reserve keep the name index consistent") {
+        section wide("Wide");
+        for (int i = 0; i < 20; ++i) wide.add(para("p" + std::to_string(i)));
+        CHECK(wide.find_child("p17") == &wide.children()[17]);  // 색인 생성
+
+        section moved(std::move(wide));
+        CHECK(moved.find_child("p17") == &moved.children()[17]);
+
+        // 옮겨진 쪽을 다시 채워도 이전 색인을 쓰지 않는다
+        for (int i = 0; i < 20; ++i) wide.add(para("q" + std::to_string(i)));
+        CHECK(wide.find_child("q3") == &wide.children()[3]);
+        CHECK(wide.find_child("p17") == nullptr);
+
+        moved.reserve(256);
+        CHECK(moved.find_child("p17") == &moved.children()[17]);
+        CHECK(moved.subtree_size() == moved.aggregate<aggregates::count>());
+    }
+}
@@ -0,0 +1,208 @@
+/**
+ * @file tests/unit/test_edge_attributes.cpp
+ * @brief 접힘선 속성 열(SoA) 저장소와 접힘선 번호 접근 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/edge_attributes.hpp>
+#include <origami/mapped_format.hpp>
+#include <origami/origami_composite.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace metaloki::origami;
+using namespace metaloki::origami::graph;
+
+enum class fold : std::uint8_t { mountain, valley };
+
+// 산/골, 접힘 각, 강성
+using crease_attributes = edge_attributes<fold, double, double>;
+
+static const edge_options undirected{edge_mode::undirected, false};
+
+// 격자 + 암시적 격자 + 불규칙 보정 연결 (중복, 자기 연결 포함)
+static origami_composite<int> make_pattern(edge_options options) {
+    origami_composite<int> pattern("Creases", options);
+    pattern.create_miura_pattern(6, 5);
+    const size_t base = pattern.create_implicit_miura_pattern(4, 3);
+    pattern.connect(base + 5, 3);
+    pattern.connect(3, base + 5);
+    pattern.connect(base + 11, 0);
+    pattern.connect(7, 7);
+    pattern.connect(base + 1, base + 9);
+    return pattern;
+}
+
+// for_each_edge 가 내놓는 순서 = 접힘선 번호
+template<typename Pattern>
+static std::vector<std::pair<size_t, size_t>> edges_in_order(const Pattern& pattern) {
+    std::vector<std::pair<size_t, size_t>> edges;
+    pattern.for_each_edge([&edges](size_t from, size_t to, const int&, const int&) { edges.emplace_back(from, to); });
+    return edges;
+}
+
+// 모든 노드에서 visit_connection_ids 가 번호의 접힘선 끝을 정확히 가리키는지
+template<typename Pattern>
+static void check_ids(const Pattern& pattern, const std::vector<std::pair<size_t, size_t>>& edges) {
+    std::vector<size_t> seen(edges.size(), 0);
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        std::vector<size_t> targets;
+        pattern.visit_connection_ids(i, [&](size_t from, size_t to, size_t edge) {
+            REQUIRE(edge < edges.size());
+            const auto [owner, other] = edges[edge];
+            CHECK(std::minmax(from, to) == std::minmax(owner, other));
+            targets.push_back(to);
+            ++seen[edge];
+        });
+
+        // visit_connections 와 같은 순서
+        std::vector<size_t> expected;
+        pattern.visit_connections(i, [&expected](size_t, size_t to, const int&, const int&) { expected.push_back(to); });
+        CHECK(targets == expected);
+    }
+    for (size_t edge = 0; edge < edges.size(); ++edge) {
+        const bool self_loop = edges[edge].first == edges[edge].second;
+        CHECK(seen[edge] == (self_loop ? 1u : 2u));
+    }
+}
+
+TEST_SUITE("ORIGAMI edge attributes") {
+
+    TEST_CASE("Undirected creases get one id visited from both ends") {
+        auto pattern = make_pattern(undirected);
+        const auto edges = edges_in_order(pattern);
+        REQUIRE(edges.size() == pattern.edge_count());
+        check_ids(pattern, edges);
+
+        // crease_graph 는 패턴의 번호를 그대로 - 양 끝이 같은 행
+        const auto g = crease_graph::from(pattern);
+        CHECK(g.crease_count() == edges.size());
+        CHECK(g.edge_count() == 2 * edges.size() - 1);  // 자기 연결은 한 번
+        const auto attributes = crease_attributes::from(g, [](vertex from, vertex to, size_t edge) {
+            const fold kind = (from + to) % 2 ? fold::mountain : fold::valley;
+            return std::tuple{kind, 0.5 * static_cast<double>(edge), 1.0 + static_cast<double>(std::min(from, to))};
+        });
+        REQUIRE(attributes.size() == edges.size());
+
+        for (vertex v = 0; v < g.node_count(); ++v) {
+            g.visit_connections(v, [&](vertex from, vertex to, size_t edge) {
+                CHECK(from == v);
+                CHECK(std::minmax<size_t>(from, to) == std::minmax(edges[edge].first, edges[edge].second));
+                CHECK(attributes.at<1>(edge) == 0.5 * static_cast<double>(edge));
+                const auto [kind, angle, stiffness] = attributes.row(edge);
+                CHECK(kind == ((from + to) % 2 ? fold::mountain : fold::valley));
+                CHECK(stiffness == 1.0 + static_cast<double>(std::min(from, to)));
+                const auto mirror = g.find_edge(to, from);  // 중복 연결이면 같은 쌍의 다른 접힘선일 수 있다
+                REQUIRE(mirror.has_value());
+                CHECK(std::minmax(edges[*mirror].first, edges[*mirror].second) == std::minmax<size_t>(from, to));
+            });
+        }
+        CHECK_FALSE(g.find_edge(0, 29).has_value());
+    }
+
+    TEST_CASE("Snapshots keep their numbering across later edits") {
+        auto pattern = make_pattern(undirected);
+        const auto before = edges_in_order(pattern);
+        const auto frozen = pattern.take_snapshot();
+
+        pattern.connect(0, 1);
+        pattern.connect(2, 40);
+        const auto after = edges_in_order(pattern);
+        CHECK(after.size() == before.size() + 2);
+        check_ids(pattern, after);
+
+        // 스냅샷은 편집 전 번호 - 패턴의 번호를 먼저 매겨도 영향 없다
+        check_ids(frozen, before);
+        CHECK(crease_graph::from(frozen).crease_count() == before.size());
+    }
+
+    TEST_CASE("Directed connections in both directions share one crease id") {
+        // 3x3 격자는 접힘선 16 개 - 방향 연결 32 개
+        origami_composite<int> grid;
+        grid.create_miura_pattern(3, 3);
+        const auto g = crease_graph::from(grid);
+        CHECK(g.edge_count() == 32);
+        CHECK(g.crease_count() == 16);
+        CHECK(g.find_edge(0, 1) == g.find_edge(1, 0));
+
+        // 매핑된 파일은 visit_connections 만 있어 짝짓기로 번호를 매긴다 - 같은 번호여야 한다
+        const auto image = binary::serialize(grid);
+        const auto view = binary::pattern_view<int>::open(image);
+        const auto mapped = crease_graph::from(view);
+        CHECK(std::ranges::equal(mapped.crease_ids(), g.crease_ids()));
+
+        // 짝 없는 연결과 자기 연결은 혼자 번호를 갖는다
+        const auto pattern = make_pattern(edge_options{});
+        const auto numbered = crease_graph::from(pattern);
+        const crease_graph paired(std::vector<size_t>(numbered.offsets().begin(), numbered.offsets().end()),
+                                  std::vector<vertex>(numbered.targets().begin(), numbered.targets().end()));
+        CHECK(std::ranges::equal(numbered.crease_ids(), paired.crease_ids()));
+        CHECK(numbered.crease_count() == miura_lattice(6, 5).edge_count() + miura_lattice(4, 3).edge_count() + 4);
+
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            std::vector<size_t> ids;
+            pattern.visit_connection_ids(i, [&](size_t from, size_t, size_t edge) {
+                CHECK(from == i);
+                ids.push_back(edge);
+            });
+            const auto expected = numbered.crease_ids().subspan(numbered.edge_begin(static_cast<vertex>(i)), ids.size());
+            CHECK(std::ranges::equal(ids, expected));
+        }
+    }
+
+    TEST_CASE("Raw adjacency pairs mirrored entries") {
+        // 0-1 양방향, 1->2 한 방향, 2-0 양방향 두 번, 3 자기 연결
+        const crease_graph g({0, 3, 5, 7, 8}, {1, 2, 2, 0, 2, 0, 0, 3});
+        CHECK(g.crease_count() == 5);
+        CHECK(std::vector<size_t>(g.crease_ids().begin(), g.crease_ids().end())
+              == std::vector<size_t>{0, 1, 2, 0, 3, 1, 2, 4});
+        CHECK(g.find_edge(1, 0) == 0);
+        CHECK(g.find_edge(0, 1) == 0);
+        CHECK_FALSE(g.find_edge(2, 1).has_value());
+
+        const auto attributes = edge_attributes<double>::from(g, [](vertex from, vertex to, size_t) {
+            return std::tuple{static_cast<double>(from * 10 + to)};
+        });
+        CHECK(attributes.at<0>(0) == 1.0);   // 소유자 0 에서 한 번
+        CHECK(attributes.at<0>(3) == 12.0);
+        CHECK(attributes.at<0>(4) == 33.0);
+    }
+
+    TEST_CASE("Columns are contiguous and writable") {
+        origami_composite<int> pattern("Grid", undirected);
+        pattern.create_miura_pattern(6, 5);
+        const auto g = crease_graph::from(pattern);
+        crease_attributes attributes(g);
+        CHECK(attributes.column<fold>().size() == g.crease_count());
+        CHECK(attributes.column<2>()[3] == 0.0);
+
+        // 열 단위 커널 - 강성 * 각도 제곱 합
+        auto angle = attributes.column<1>();
+        auto stiffness = attributes.column<2>();
+        for (size_t e = 0; e < angle.size(); ++e) {
+            angle[e] = 0.1;
+            stiffness[e] = 2.0;
+        }
+        double energy = 0.0;
+        for (size_t e = 0; e < angle.size(); ++e) energy += stiffness[e] * angle[e] * angle[e];
+        CHECK(energy == doctest::Approx(0.02 * static_cast<double>(miura_lattice(6, 5).edge_count())));
+
+        attributes.set(4, fold::mountain, 1.5, 3.0);
+        auto [kind, fold_angle, k] = attributes.row(4);
+        CHECK(kind == fold::mountain);
+        fold_angle = 2.5;
+        CHECK(attributes.at<1>(4) == 2.5);
+        CHECK(k == 3.0);
+
+        CHECK_THROWS_AS(attributes.set(g.crease_count(), fold::valley, 0.0, 0.0), std::out_of_range);
+        CHECK_THROWS_AS(attributes.row(g.crease_count()), std::out_of_range);
+
+        attributes.resize(3);
+        CHECK(attributes.column<0>().size() == 3);
+        CHECK(edge_attributes<float>().empty());
+    }
+}
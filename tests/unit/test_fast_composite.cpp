@@ -0,0 +1,93 @@
+/**
+ * @file tests/unit/test_fast_composite.cpp
+ * @brief 타입 분할 fast_composite / fast_iterator / fast_visitor 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/optimized_patterns.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+using namespace metaloki::origami::optimized;
+
+using int_leaf = leaf<int>;
+using string_leaf = leaf<std::string>;
+using mixed = composite<int_leaf, string_leaf>;
+using fast_mixed = fast_composite<int_leaf, string_leaf>;
+
+TEST_SUITE("ORIGAMI fast composite") {
+
+    TEST_CASE("Children are partitioned by type in insertion order") {
+        mixed source("Mixed");
+        for (int i = 0; i < 10; ++i) {
+            source.add(int_leaf(i));
+            if (i % 3 == 0) source.add(string_leaf("s" + std::to_string(i)));
+        }
+
+        const auto fast = fast_mixed::from(source);
+        CHECK(fast.name() == "Mixed");
+        CHECK(fast.size() == 14);
+        CHECK(fast.size<int_leaf>() == 10);
+        CHECK(fast.children_of<string_leaf>()[1].value() == "s3");
+        CHECK(fast.partition<int_leaf>().back().value() == 9);
+
+        // 파티션 순서로 되돌린다 - int 전부, 그다음 string
+        const auto back = fast.to_composite();
+        REQUIRE(back.children().size() == 14);
+        CHECK(std::get<int_leaf>(back.children()[9]).value() == 9);
+        CHECK(std::get<string_leaf>(back.children()[10]).value() == "s0");
+    }
+
+    TEST_CASE("Iteration and reductions run per partition") {
+        fast_mixed document("Doc");
+        document.append_range(std::vector<int_leaf>{int_leaf(1), int_leaf(2), int_leaf(3)});
+        document.add(string_leaf("text"));
+        document.emplace<int_leaf>(4);
+
+        std::vector<std::string> order;
+        const fast_iterator<int_leaf, string_leaf> iterator;
+        iterator.fast_for_each(document, [&order](const auto& element) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(element)>, int_leaf>) {
+                order.push_back(std::to_string(element.value()));
+            } else {
+                order.push_back(element.value());
+            }
+        });
+        CHECK(order == std::vector<std::string>{"1", "2", "3", "4", "text"});
+
+        CHECK(iterator.fast_reduce<int_leaf>(document, 0L, std::plus<>{},
+                                             [](const int_leaf& element) { return element.value(); }) == 10);
+        fast_visitor<long> visitor;
+        CHECK(visitor.visit(document) == 10);
+        CHECK(visitor.visit(int_leaf(7)) == 7);
+        CHECK(visitor.visit(string_leaf("x")) == 0);
+    }
+
+    TEST_CASE("fast_builder fills partitions with single reservations") {
+        auto built = fast_builder<int_leaf, string_leaf>{"Built"}
+            .add(int_leaf(1))
+            .add_all(int_leaf(2), string_leaf("a"), int_leaf(3))
+            .add_range(std::vector<string_leaf>{string_leaf("b"), string_leaf("c")})
+            .finish();
+
+        REQUIRE(built != nullptr);
+        CHECK(built->name() == "Built");
+        CHECK(built->size<int_leaf>() == 3);
+        CHECK(built->size<string_leaf>() == 3);
+
+        built->clear();
+        CHECK(built->empty());
+
+        // lvalue 는 복사되고 원본은 그대로 남는다
+        const string_leaf kept("kept");
+        string_leaf label("label");
+        auto copied = fast_builder<int_leaf, string_leaf>{"Copied"}.add(label).add(kept).finish();
+        CHECK(label.value() == "label");
+        CHECK(copied->children_of<string_leaf>()[0].value() == "label");
+        CHECK(copied->children_of<string_leaf>()[1].value() == "kept");
+    }
+}
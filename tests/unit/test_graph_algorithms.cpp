@@ -0,0 +1,191 @@
+/**
+ * @file tests/unit/test_graph_algorithms.cpp
+ * @brief 접힘선 그래프 알고리즘(BFS/DFS, 연결 요소, Dijkstra, 방향 최적화 BFS) 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/graph_algorithms.hpp>
+#include <origami/origami_composite.hpp>
+#include <cstdint>
+#include <vector>
+
+using namespace metaloki::origami;
+using namespace metaloki::origami::graph;
+
+// 간선마다 전체를 훑는 Bellman-Ford - 최단 거리 비교용
+template<typename Weight, typename WeightFunction>
+static std::vector<Weight> reference_distances(const crease_graph& g, vertex source, WeightFunction weight) {
+    std::vector<Weight> distance(g.node_count(), shortest_paths<Weight>::unreachable);
+    distance[source] = Weight{};
+    for (size_t round = 0; round < g.node_count(); ++round) {
+        for (vertex v = 0; v < g.node_count(); ++v) {
+            if (distance[v] == shortest_paths<Weight>::unreachable) continue;
+            for (vertex u : g.neighbors(v)) distance[u] = std::min(distance[u], distance[v] + weight(v, u));
+        }
+    }
+    return distance;
+}
+
+static origami_composite<int> make_two_islands() {
+    // 5x4 격자 + 떨어진 삼각형 + 외톨이 노드
+    origami_composite<int> pattern("Islands");
+    pattern.create_implicit_miura_pattern(5, 4);
+    const size_t a = pattern.add_element(100);
+    const size_t b = pattern.add_element(101);
+    const size_t c = pattern.add_element(102);
+    pattern.add_element(103);
+    for (auto [from, to] : {std::pair{a, b}, {b, c}, {c, a}}) {
+        pattern.connect(from, to);
+        pattern.connect(to, from);
+    }
+    return pattern;
+}
+
+TEST_SUITE("ORIGAMI graph algorithms") {
+
+    TEST_CASE("crease_graph mirrors visit_connections") {
+        const auto pattern = make_two_islands();
+        const auto g = crease_graph::from(pattern);
+        REQUIRE(g.node_count() == pattern.size());
+
+        size_t connections = 0;
+        for (vertex v = 0; v < g.node_count(); ++v) {
+            std::vector<vertex> expected;
+            pattern.visit_connections(v, [&expected](size_t, size_t to, const auto&, const auto&) {
+                expected.push_back(static_cast<vertex>(to));
+            });
+            const auto neighbors = g.neighbors(v);
+            CHECK(std::vector<vertex>(neighbors.begin(), neighbors.end()) == expected);
+            CHECK(g.degree(v) == pattern.degree(v));
+            connections += expected.size();
+        }
+        CHECK(g.edge_count() == connections);
+        CHECK(crease_graph::from(pattern.take_snapshot()).edge_count() == connections);
+
+        CHECK_THROWS_AS(crease_graph({0, 1}, {3}), std::out_of_range);
+        CHECK_THROWS_AS(crease_graph({1, 0}, {}), std::invalid_argument);
+    }
+
+    TEST_CASE("BFS and DFS reach each node once") {
+        const auto g = crease_graph::from(make_two_islands());
+        graph_workspace workspace;
+
+        std::vector<vertex> order;
+        std::vector<std::uint32_t> depth_of(g.node_count(), unreached);
+        const size_t reached = breadth_first_search(g, 0, [&](vertex v, std::uint32_t depth) {
+            order.push_back(v);
+            depth_of[v] = depth;
+        }, workspace);
+        CHECK(reached == 20);
+        CHECK(order.front() == 0);
+        CHECK(depth_of[6] == 1);           // (1, 1) 은 (0, 0) 의 대각선 이웃
+        CHECK(depth_of[19] == 4);          // (4, 3)
+        CHECK(depth_of[20] == unreached);  // 삼각형
+        for (vertex v = 0; v < 20; ++v) {
+            for (vertex u : g.neighbors(v)) CHECK(depth_of[u] <= depth_of[v] + 1);
+        }
+
+        // 같은 작업 버퍼로 재실행, 조기 종료
+        size_t seen = 0;
+        CHECK(breadth_first_search(g, 21, [&seen](vertex, std::uint32_t) { return ++seen < 2; }, workspace) == 2);
+
+        std::vector<vertex> preorder;
+        CHECK(depth_first_search(g, 20, [&preorder](vertex v) { preorder.push_back(v); }, workspace) == 3);
+        CHECK(preorder == std::vector<vertex>{20, 21, 22});
+        CHECK(depth_first_search(g, 23, [](vertex) {}) == 1);
+
+        // DFS 는 첫 이웃부터 깊게 - 0 -> 1 -> 0 은 건너뛰고 2 ...
+        preorder.clear();
+        depth_first_search(g, 0, [&preorder](vertex v) { return preorder.push_back(v), preorder.size() < 5; });
+        CHECK(preorder == std::vector<vertex>{0, 1, 2, 3, 4});
+
+        CHECK_THROWS_AS(breadth_first_search(g, 99, [](vertex, std::uint32_t) {}), std::out_of_range);
+    }
+
+    TEST_CASE("Deep paths do not recurse") {
+        origami_composite<char> pattern;
+        pattern.create_implicit_miura_pattern(200000, 1);
+        const auto g = crease_graph::from(pattern);
+
+        vertex last = 0;
+        CHECK(depth_first_search(g, 0, [&last](vertex v) { last = v; }) == 200000);
+        CHECK(last == 199999);
+        CHECK(bfs_depths(g, 0).back() == 199999);
+    }
+
+    TEST_CASE("Connected components label islands in node order") {
+        const auto g = crease_graph::from(make_two_islands());
+        const auto components = connected_components(g);
+        CHECK(components.count == 3);
+        CHECK(components.label[0] == 0);
+        CHECK(components.label[19] == 0);
+        CHECK(components.label[20] == 1);
+        CHECK(components.label[22] == 1);
+        CHECK(components.label[23] == 2);
+
+        union_find sets(4);
+        CHECK(sets.unite(0, 1));
+        CHECK_FALSE(sets.unite(1, 0));
+        CHECK(sets.set_count() == 3);
+    }
+
+    TEST_CASE("Dijkstra matches Bellman-Ford for both heaps") {
+        origami_composite<int> pattern;
+        pattern.create_miura_pattern(12, 9);
+        const auto g = crease_graph::from(pattern);
+
+        auto weight = [](vertex from, vertex to) { return static_cast<std::uint64_t>((from * 7 + to * 13) % 11 + 1); };
+        const auto by_radix = dijkstra<std::uint64_t>(g, 5, weight);
+        CHECK(by_radix.distance == reference_distances<std::uint64_t>(g, 5, weight));
+
+        auto real_weight = [&weight](vertex from, vertex to) { return static_cast<double>(weight(from, to)) * 0.5; };
+        const auto by_binary = dijkstra<double>(g, 5, real_weight);
+        for (vertex v = 0; v < g.node_count(); ++v) CHECK(by_binary.distance[v] == by_radix.distance[v] * 0.5);
+
+        // 경로는 간선을 따라가고 길이가 거리와 같다
+        const auto path = by_radix.path_to(107);
+        REQUIRE(path.size() >= 2);
+        CHECK(path.front() == 5);
+        std::uint64_t length = 0;
+        for (size_t i = 0; i + 1 < path.size(); ++i) length += weight(path[i], path[i + 1]);
+        CHECK(length == by_radix.distance[107]);
+
+        // 간선 id 를 받는 가중치 - 단위 가중치면 BFS 깊이와 같다
+        const auto hops = dijkstra<std::uint32_t>(g, 0, [](vertex, vertex, size_t) { return 1u; });
+        CHECK(hops.distance == bfs_depths(g, 0));
+
+        const auto islands = crease_graph::from(make_two_islands());
+        const auto partial = dijkstra<std::uint32_t>(islands, 20, [](vertex, vertex) { return 1u; });
+        CHECK_FALSE(partial.reachable(0));
+        CHECK(partial.path_to(0).empty());
+    }
+
+    TEST_CASE("radix_heap pops in key order") {
+        radix_heap<std::uint32_t, int> heap;
+        for (std::uint32_t key : {9u, 3u, 3u, 17u, 4u}) heap.push(key, static_cast<int>(key));
+        CHECK(heap.pop().first == 3);
+        heap.push(5, 5);
+        std::vector<std::uint32_t> keys;
+        while (!heap.empty()) keys.push_back(heap.pop().first);
+        CHECK(keys == std::vector<std::uint32_t>{3, 4, 5, 9, 17});
+        CHECK_THROWS_AS(heap.push(1, 1), std::logic_error);
+    }
+
+    TEST_CASE("Direction-optimizing BFS matches top-down BFS") {
+        origami_composite<char> grid;
+        grid.create_implicit_miura_pattern(300, 200);
+        const auto g = crease_graph::from(grid);
+
+        for (vertex source : {vertex{0}, vertex{30150}, vertex{59999}}) {
+            CHECK(direction_optimizing_bfs(g, source) == bfs_depths(g, source));
+        }
+        // 항상 bottom-up / 항상 top-down 으로 강제해도 같다
+        CHECK(direction_optimizing_bfs(g, 7, {1, g.node_count() + 1}) == bfs_depths(g, 7));
+        CHECK(direction_optimizing_bfs(g, 7, {g.edge_count() + 1, 1}) == bfs_depths(g, 7));
+
+        const auto islands = crease_graph::from(make_two_islands());
+        CHECK(direction_optimizing_bfs(islands, 21, {1, 1}) == bfs_depths(islands, 21));
+    }
+}
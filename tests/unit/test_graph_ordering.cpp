@@ -0,0 +1,195 @@
+/**
+ * @file tests/unit/test_graph_ordering.cpp
+ * @brief 노드 재배치 순서(BFS, RCM, Hilbert)와 origami_composite::reorder 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/graph_ordering.hpp>
+#include <origami/origami_composite.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace metaloki::origami;
+using namespace metaloki::origami::graph;
+
+static bool is_permutation_of_nodes(const std::vector<vertex>& order, size_t nodes) {
+    std::vector<vertex> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return sorted.size() == nodes;
+}
+
+// 이웃 번호 차의 최댓값
+static size_t bandwidth(const crease_graph& g) {
+    size_t widest = 0;
+    for (vertex v = 0; v < g.node_count(); ++v) {
+        for (vertex u : g.neighbors(v)) widest = std::max<size_t>(widest, u > v ? u - v : v - u);
+    }
+    return widest;
+}
+
+template<typename Pattern>
+static std::vector<std::pair<size_t, size_t>> edges_of(const Pattern& pattern) {
+    std::vector<std::pair<size_t, size_t>> edges;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        pattern.visit_connections(i, [&edges](size_t from, size_t to, const auto&, const auto&) { edges.emplace_back(from, to); });
+    }
+    return edges;
+}
+
+// 사용자가 임의 순서로 만든 패턴 흉내 - 격자를 무작위로 섞는다
+static origami_composite<int> make_shuffled_grid(size_t width, size_t height) {
+    origami_composite<int> pattern("Shuffled");
+    pattern.create_miura_pattern(width, height);
+    std::vector<size_t> order(pattern.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937{42});
+    pattern.reorder(order);
+    return pattern;
+}
+
+// 정해진 횟수만큼 복사한 뒤 던지는 요소 - 옮기면 원본 문자열이 비워진다
+struct fragile {
+    static inline int copies_left = 0;
+    std::string name;
+
+    explicit fragile(std::string n = {}) : name(std::move(n)) {}
+    fragile(const fragile& other) : name(other.name) {
+        if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    }
+    fragile(fragile&&) noexcept = default;
+    fragile& operator=(const fragile&) = default;
+    fragile& operator=(fragile&&) noexcept = default;
+};
+
+TEST_SUITE("ORIGAMI graph ordering") {
+
+    TEST_CASE("Orderings are permutations") {
+        const auto pattern = make_shuffled_grid(23, 17);
+        const auto g = crease_graph::from(pattern);
+
+        CHECK(is_permutation_of_nodes(bfs_order(g, 5), g.node_count()));
+        CHECK(bfs_order(g, 5).front() == 5);
+        CHECK(is_permutation_of_nodes(reverse_cuthill_mckee(g), g.node_count()));
+        CHECK(is_permutation_of_nodes(hilbert_order(miura_lattice(23, 17)), 23 * 17));
+        CHECK(hilbert_order(miura_lattice(0, 5)).empty());
+
+        // 여러 요소와 외톨이 노드
+        origami_composite<int> islands;
+        islands.create_miura_pattern(4, 4);
+        islands.add_element(0);
+        islands.create_miura_pattern(3, 2);
+        const auto split = crease_graph::from(islands);
+        CHECK(is_permutation_of_nodes(bfs_order(split), split.node_count()));
+        CHECK(is_permutation_of_nodes(reverse_cuthill_mckee(split), split.node_count()));
+
+        const std::vector<vertex> order{2, 0, 3, 1};
+        CHECK(inverse_permutation<vertex>(order) == std::vector<vertex>{1, 3, 0, 2});
+    }
+
+    TEST_CASE("Hilbert order walks between grid neighbours") {
+        const miura_lattice lattice(16, 16);
+        const auto order = hilbert_order(lattice);
+        for (size_t i = 1; i < order.size(); ++i) {
+            const long dx = static_cast<long>(order[i] % 16) - static_cast<long>(order[i - 1] % 16);
+            const long dy = static_cast<long>(order[i] / 16) - static_cast<long>(order[i - 1] / 16);
+            CHECK(std::abs(dx) + std::abs(dy) == 1);
+        }
+    }
+
+    TEST_CASE("Reordering permutes nodes and remaps edges") {
+        origami_composite<int> pattern;
+        pattern.create_miura_tile(miura_lattice(5, 4), {0, 0, 5, 4}, [](size_t x, size_t y) {
+            return static_cast<int>(y * 5 + x);
+        });
+        const auto before = edges_of(pattern);
+        const auto frozen = pattern.take_snapshot();
+
+        const auto order = reverse_cuthill_mckee(crease_graph::from(pattern));
+        const auto new_index = pattern.reorder(order);
+        REQUIRE(new_index.size() == pattern.size());
+
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            CHECK(pattern.get_element(new_index[i]) == static_cast<int>(i));
+            CHECK(static_cast<size_t>(order[new_index[i]]) == i);
+        }
+
+        // 연결은 새 번호로, 노드별 순서는 그대로
+        std::vector<std::pair<size_t, size_t>> mapped;
+        for (auto [from, to] : before) mapped.emplace_back(new_index[from], new_index[to]);
+        std::stable_sort(mapped.begin(), mapped.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        CHECK(edges_of(pattern) == mapped);
+
+        // 스냅샷은 이전 배열
+        CHECK(edges_of(frozen) == before);
+        CHECK(frozen.get_element(7) == 7);
+
+        CHECK_THROWS_AS(pattern.reorder(std::vector<size_t>{0, 1}), std::logic_error);
+        std::vector<size_t> duplicated(pattern.size(), 0);
+        CHECK_THROWS_AS(pattern.reorder(duplicated), std::logic_error);
+    }
+
+    TEST_CASE("A throwing element copy leaves the pattern untouched") {
+        origami_composite<fragile> pattern;
+        for (int i = 0; i < 6; ++i) pattern.add_element(fragile("node " + std::to_string(i)));
+        for (size_t i = 1; i < 6; ++i) pattern.connect(i - 1, i);
+
+        fragile::copies_left = 3;
+        CHECK_THROWS_AS(pattern.reorder(std::vector<size_t>{5, 4, 3, 2, 1, 0}), std::runtime_error);
+        for (size_t i = 0; i < 6; ++i) {
+            CHECK(pattern.get_element(i).name == "node " + std::to_string(i));
+            CHECK(pattern.degree(i) == (i < 5 ? 1u : 0u));
+        }
+
+        fragile::copies_left = 100;
+        pattern.reorder(std::vector<size_t>{5, 4, 3, 2, 1, 0});
+        CHECK(pattern.get_element(0).name == "node 5");
+    }
+
+    TEST_CASE("Implicit lattices are written out before reordering") {
+        origami_composite<int> pattern;
+        pattern.add_element(-1);
+        const size_t base = pattern.create_implicit_miura_pattern(6, 5);
+        pattern.connect(base + 3, 0);
+        pattern.connect(0, base + 3);
+        const auto before = edges_of(pattern);
+
+        const miura_lattice lattice(6, 5);
+        std::vector<vertex> order{0};
+        for (vertex v : hilbert_order(lattice)) order.push_back(static_cast<vertex>(base + v));
+        const auto new_index = pattern.reorder(order);
+
+        CHECK_FALSE(pattern.is_implicit(1));
+        size_t edges = 0;
+        for (auto [from, to] : before) {
+            const auto connections = edges_of(pattern);
+            CHECK(std::find(connections.begin(), connections.end(), std::pair{new_index[from], new_index[to]}) != connections.end());
+            ++edges;
+        }
+        CHECK(edges_of(pattern).size() == edges);
+    }
+
+    TEST_CASE("Reverse Cuthill-McKee narrows a shuffled grid") {
+        const auto pattern = make_shuffled_grid(40, 30);
+        const auto shuffled = crease_graph::from(pattern);
+
+        auto reordered = pattern;
+        reordered.reorder(reverse_cuthill_mckee(shuffled));
+        const size_t narrowed = bandwidth(crease_graph::from(reordered));
+        CHECK(bandwidth(shuffled) > 1000);
+        CHECK(narrowed <= 2 * 31);
+
+        auto by_bfs = pattern;
+        by_bfs.reorder(bfs_order(shuffled));
+        CHECK(bandwidth(crease_graph::from(by_bfs)) < 200);
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file tests/unit/test_implicit_pattern.cpp
+ * @brief origami_composite 암시적(좌표 계산) Miura 연결 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/origami_composite.hpp>
+#include <origami/renderer.hpp>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+template<typename Pattern>
+static std::vector<size_t> connections_of(const Pattern& pattern, size_t index) {
+    std::vector<size_t> result;
+    pattern.visit_connections(index, [&result](size_t, size_t to, const auto&, const auto&) { result.push_back(to); });
+    return result;
+}
+
+static std::string render_json(const origami_composite<int>& pattern) {
+    std::string json;
+    string_sink sink{json};
+    render_to(sink, pattern);
+    return json;
+}
+
+TEST_SUITE("ORIGAMI implicit pattern") {
+
+    TEST_CASE("Implicit lattices visit the same connections as stored ones") {
+        origami_composite<int> stored("Grid");
+        stored.create_miura_pattern(9, 6);
+
+        origami_composite<int> implicit("Grid");
+        CHECK(implicit.create_implicit_miura_pattern(9, 6) == 0);
+        REQUIRE(implicit.size() == stored.size());
+
+        for (size_t i = 0; i < stored.size(); ++i) {
+            CHECK(implicit.is_implicit(i));
+            CHECK(connections_of(implicit, i) == connections_of(stored, i));
+            CHECK(implicit.degree(i) == stored.degree(i));
+        }
+        CHECK(render_json(implicit) == render_json(stored));
+    }
+
+    TEST_CASE("Explicit overrides follow the lattice neighbours") {
+        origami_composite<int> pattern;
+        const size_t anchor = pattern.add_element(-1);
+        const size_t base = pattern.create_implicit_miura_pattern(4, 4, [](size_t x, size_t y) {
+            return static_cast<int>(y * 10 + x);
+        });
+        CHECK(base == 1);
+        CHECK_FALSE(pattern.is_implicit(anchor));
+        CHECK(pattern.get_element(base + 6) == 12);
+
+        // (0, 0): 오른쪽, 아래, 우하 - 그리고 보정 연결
+        pattern.connect(base, anchor);
+        pattern.connect(anchor, base);
+        CHECK(connections_of(pattern, base) == std::vector<size_t>{base + 1, base + 4, base + 5, anchor});
+        CHECK(connections_of(pattern, anchor) == std::vector<size_t>{base});
+
+        // 스냅샷과 복제본도 같은 위상을 본다
+        const auto frozen = pattern.take_snapshot();
+        CHECK(connections_of(frozen, base) == connections_of(pattern, base));
+        const auto copy = pattern.clone();
+        CHECK(connections_of(*copy, base + 5) == connections_of(pattern, base + 5));
+
+        CHECK_THROWS_AS(pattern.create_implicit_miura_pattern(2, 2), std::logic_error);
+    }
+
+    TEST_CASE("Very large implicit lattices store no edges") {
+        origami_composite<char> pattern;
+        pattern.create_implicit_miura_pattern(2000, 2000);
+        CHECK(pattern.size() == 4000000);
+
+        const miura_lattice lattice(2000, 2000);
+        const size_t center = lattice.index(1000, 1000);
+        CHECK(pattern.degree(center) == miura_lattice::max_degree);
+        CHECK(pattern.degree(lattice.index(1001, 1000)) == 4);
+        CHECK(pattern.degree(0) == 3);
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @file tests/unit/test_leaf_columns.cpp
+ * @brief composite leaf 값 열 색인 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/composite.hpp>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using double_leaf = leaf<double>;
+using string_leaf = leaf<std::string>;
+using row = composite<int_leaf, double_leaf, string_leaf>;
+using table = composite<row, int_leaf>;
+
+TEST_SUITE("ORIGAMI leaf columns") {
+
+    TEST_CASE("Columns hold values with pre-order node ids") {
+        table root("Table");
+        root.add(int_leaf(5));
+
+        row first("first");
+        first.add(int_leaf(1));
+        first.add(double_leaf(2.5));
+        first.add(string_leaf("label"));
+        first.add(int_leaf(3));
+        root.add(std::move(first));
+
+        // Table(0) 5(1) first(2) 1(3) 2.5(4) label(5) 3(6)
+        const auto& ints = root.column<int>();
+        CHECK(std::vector<int>(ints.values().begin(), ints.values().end()) == std::vector<int>{5, 1, 3});
+        CHECK(std::vector<std::uint32_t>(ints.node_ids().begin(), ints.node_ids().end())
+              == std::vector<std::uint32_t>{1, 3, 6});
+        CHECK(ints.sum() == 9);
+        CHECK(*ints.min() == 1);
+        CHECK(*ints.max() == 5);
+        CHECK(*ints.mean() == doctest::Approx(3.0));
+        CHECK(ints.count_if([](int value) { return value > 2; }) == 2);
+
+        const auto& doubles = root.column<double>();
+        CHECK(doubles.size() == 1);
+        CHECK(doubles.node_ids()[0] == 4);
+
+        CHECK(root.column<long>().empty());
+        CHECK_FALSE(root.column<long>().mean().has_value());
+    }
+
+    TEST_CASE("Columns follow changes anywhere in the subtree") {
+        table root("Table");
+        for (int r = 0; r < 50; ++r) {
+            row current("row" + std::to_string(r));
+            for (int c = 0; c < 20; ++c) current.add(int_leaf(r * 20 + c));
+            root.add(std::move(current));
+        }
+
+        CHECK(root.column<int>().sum() == 999 * 1000 / 2);
+        CHECK(root.column<int>().sum() == root.aggregate<aggregates::sum<int>>());
+
+        // 직접 변경
+        root.add(int_leaf(1000));
+        CHECK(root.column<int>().sum() == 1000 * 1001 / 2);
+
+        // 중첩 composite 변경은 조상 캐시까지 무효화된다
+        auto& nested = std::get<row>(root.children()[10]);
+        nested.add(int_leaf(-500));
+        CHECK(root.column<int>().size() == 1002);
+        CHECK(root.column<int>().sum() == 1000 * 1001 / 2 - 500);
+        CHECK(nested.column<int>().sum() == 200 * 20 + 190 - 500);
+
+        // 복사본은 빈 캐시에서 다시 만든다
+        const table copy = root;
+        CHECK(copy.column<int>().sum() == root.column<int>().sum());
+    }
+}
@@ -0,0 +1,148 @@
+/**
+ * @file tests/unit/test_mapped_format.cpp
+ * @brief mmap 바이너리 형식 쓰기/zero-copy 읽기 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/mapped_format.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using double_leaf = leaf<double>;
+using string_leaf = leaf<std::string>;
+using row = composite<int_leaf, double_leaf>;
+using sheet = composite<string_leaf, row, int_leaf>;
+
+struct fold_point {
+    float x = 0;
+    float y = 0;
+};
+
+static sheet make_sheet() {
+    sheet result("Sheet");
+    result.emplace<string_leaf>("header");
+    for (int r = 0; r < 3; ++r) {
+        row current("Row");
+        for (int c = 0; c < 4; ++c) current.emplace<int_leaf>(r * 10 + c);
+        current.emplace<double_leaf>(0.5 * r);
+        result.add(std::move(current));
+    }
+    result.emplace<int_leaf>(-7);
+    return result;
+}
+
+TEST_SUITE("ORIGAMI mapped format") {
+
+    TEST_CASE("Trees round-trip through the zero-copy view") {
+        const auto image = binary::serialize(make_sheet());
+        const auto view = binary::tree_view<sheet>::open(image);
+
+        CHECK(view.node_count() == 1 + 5 + 3 * 5);
+
+        const auto root = view.root();
+        CHECK(root.name() == "Sheet");
+        REQUIRE(root.size() == 5);
+        CHECK(root[0].get<string_leaf>() == "header");
+        CHECK(root[4].get<int_leaf>() == -7);
+
+        const auto second = root[2].get<row>();
+        CHECK(second.name() == "Row");
+        CHECK(second[3].get<int_leaf>() == 13);
+        CHECK(second[4].get<double_leaf>() == 0.5);
+
+        // 값은 이미지 안을 직접 가리킨다
+        const int& cell = second[0].get<int_leaf>();
+        CHECK(reinterpret_cast<const std::byte*>(&cell) >= image.data());
+        CHECK(reinterpret_cast<const std::byte*>(&cell) < image.data() + image.size());
+
+        int sum = 0;
+        for (auto child : root.children()) {
+            if (!child.holds<row>()) continue;
+            for (auto cell_ref : child.get<row>().children()) {
+                cell_ref.visit([&sum](const auto& value) {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(value)>, int>) sum += value;
+                });
+            }
+        }
+        CHECK(sum == (0 + 1 + 2 + 3) + (10 + 11 + 12 + 13) + (20 + 21 + 22 + 23));
+
+        CHECK_THROWS_AS(root[0].get<int_leaf>(), std::bad_variant_access);
+        CHECK_THROWS_AS(root[5], std::out_of_range);
+    }
+
+    TEST_CASE("Mismatched types and corrupt headers are rejected") {
+        auto image = binary::serialize(make_sheet());
+        CHECK_THROWS_AS(binary::tree_view<row>::open(image), std::runtime_error);
+        CHECK_THROWS_AS(binary::pattern_view<fold_point>::open(image), std::runtime_error);
+
+        image[0] = std::byte{'X'};
+        CHECK_THROWS_AS(binary::tree_view<sheet>::open(image), std::runtime_error);
+        CHECK_THROWS_AS(binary::tree_view<sheet>::open(std::span(image).first(16)), std::runtime_error);
+    }
+
+    TEST_CASE("Header counts whose byte sizes overflow are rejected") {
+        // 2^63 + 1 개 레코드의 바이트 수는 64비트에서 작은 값으로 감긴다
+        constexpr std::uint64_t wrapping_count = (std::uint64_t{1} << 63) + 1;
+
+        auto tree = binary::serialize(make_sheet());
+        binary::file_header header;
+        std::memcpy(&header, tree.data(), sizeof(header));
+        header.node_count = wrapping_count;
+        std::memcpy(tree.data(), &header, sizeof(header));
+        CHECK_THROWS_AS(binary::tree_view<sheet>::open(tree), std::runtime_error);
+
+        origami_composite<fold_point> miura("Miura");
+        miura.create_miura_pattern(3, 3);
+        auto pattern = binary::serialize(miura);
+        std::memcpy(&header, pattern.data(), sizeof(header));
+        header.node_count = wrapping_count;
+        std::memcpy(pattern.data(), &header, sizeof(header));
+        CHECK_THROWS_AS(binary::pattern_view<fold_point>::open(pattern), std::runtime_error);
+
+        std::memcpy(&header, pattern.data(), sizeof(header));
+        header.node_count = 9;
+        header.edge_count = (std::uint64_t{1} << 61) + 1;
+        std::memcpy(pattern.data(), &header, sizeof(header));
+        CHECK_THROWS_AS(binary::pattern_view<fold_point>::open(pattern), std::runtime_error);
+    }
+
+    TEST_CASE("Origami patterns are stored as CSR and read through mmap") {
+        origami_composite<fold_point> miura("Miura");
+        miura.create_miura_pattern(5, 4);
+        miura.get_element(7).x = 1.5f;
+
+        const std::string path = "test_mapped_format_pattern.bin";
+        binary::save(miura, path);
+
+        {
+            binary::mapped_file file(path);
+            const auto view = binary::pattern_view<fold_point>::open(file.bytes());
+
+            CHECK(view.pattern_name() == "Miura");
+            REQUIRE(view.size() == miura.size());
+            CHECK(view.get_element(7).x == 1.5f);
+
+            size_t edges = 0;
+            for (size_t i = 0; i < miura.size(); ++i) {
+                std::vector<size_t> expected;
+                miura.visit_connections(i, [&](size_t, size_t to, const auto&, const auto&) { expected.push_back(to); });
+
+                std::vector<size_t> actual;
+                view.visit_connections(i, [&](size_t, size_t to, const auto&, const auto&) { actual.push_back(to); });
+
+                CHECK(actual == expected);
+                edges += actual.size();
+            }
+            CHECK(view.edge_count() == edges);
+        }
+
+        std::remove(path.c_str());
+    }
+}
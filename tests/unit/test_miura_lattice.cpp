@@ -0,0 +1,156 @@
+/**
+ * @file tests/unit/test_miura_lattice.cpp
+ * @brief Miura-ori 격자 위상 계산 / 창 단위 생성 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/origami_composite.hpp>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace metaloki::origami;
+
+struct fold_point {
+    int x = -1;
+    int y = -1;
+};
+
+// 간선마다 connect 를 부르던 이전 생성 방식 - 연결 순서 비교용
+static std::vector<std::vector<size_t>> reference_connections(size_t width, size_t height) {
+    std::vector<std::vector<size_t>> connections(width * height);
+    auto connect = [&connections](size_t from, size_t to) { connections[from].push_back(to); };
+
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x + 1 < width; ++x) {
+            const size_t idx = y * width + x;
+            connect(idx, idx + 1);
+            connect(idx + 1, idx);
+        }
+    }
+    for (size_t y = 0; y + 1 < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            const size_t idx = y * width + x;
+            connect(idx, idx + width);
+            connect(idx + width, idx);
+        }
+    }
+    for (size_t y = 0; y + 1 < height; ++y) {
+        for (size_t x = 0; x + 1 < width; ++x) {
+            const size_t idx = y * width + x;
+            if ((x + y) % 2 == 0) {
+                connect(idx, idx + width + 1);
+                connect(idx + width + 1, idx);
+            } else {
+                connect(idx + 1, idx + width);
+                connect(idx + width, idx + 1);
+            }
+        }
+    }
+    return connections;
+}
+
+template<typename Pattern>
+static std::vector<size_t> connections_of(const Pattern& pattern, size_t index) {
+    std::vector<size_t> result;
+    pattern.visit_connections(index, [&result](size_t, size_t to, const auto&, const auto&) { result.push_back(to); });
+    return result;
+}
+
+TEST_SUITE("ORIGAMI miura lattice") {
+
+    TEST_CASE("Generated connections match the per-edge construction") {
+        for (auto [width, height] : {std::pair<size_t, size_t>{1, 1}, {2, 2}, {3, 5}, {8, 3}, {17, 11}}) {
+            origami_composite<fold_point> pattern;
+            pattern.create_miura_pattern(width, height);
+
+            const auto expected = reference_connections(width, height);
+            REQUIRE(pattern.size() == width * height);
+
+            size_t connections = 0;
+            for (size_t i = 0; i < pattern.size(); ++i) {
+                CHECK(connections_of(pattern, i) == expected[i]);
+                connections += expected[i].size();
+            }
+
+            const miura_lattice lattice(width, height);
+            CHECK(lattice.connection_count() == connections);
+            for (size_t y = 0; y < height; ++y) {
+                for (size_t x = 0; x < width; ++x) {
+                    CHECK(lattice.degree(x, y) == expected[lattice.index(x, y)].size());
+                }
+            }
+        }
+
+        origami_composite<fold_point> empty;
+        empty.create_miura_pattern(0, 4);
+        CHECK(empty.size() == 0);
+    }
+
+    TEST_CASE("Tiles materialize a window with local indices") {
+        const miura_lattice lattice(10000, 10000);
+        CHECK(lattice.node_count() == 100000000);
+        CHECK(lattice.edge_count() == 10000 * 9999 * 2 + 9999 * 9999);
+
+        const miura_lattice::tile window{5000, 7001, 4, 3};
+        origami_composite<fold_point> pattern;
+        pattern.add_element(fold_point{});  // 앞선 노드가 있어도 창은 뒤에 붙는다
+
+        const size_t base = pattern.create_miura_tile(lattice, window, [](size_t x, size_t y) {
+            return fold_point{static_cast<int>(x), static_cast<int>(y)};
+        });
+        CHECK(base == 1);
+        CHECK(pattern.size() == 1 + window.node_count());
+        CHECK(pattern.get_element(base + 5).x == 5001);
+        CHECK(pattern.get_element(base + 5).y == 7002);
+
+        size_t connections = 0;
+        for (size_t i = base; i < pattern.size(); ++i) connections += connections_of(pattern, i).size();
+        CHECK(connections == 2 * miura_lattice::edge_count(window));
+
+        // 창 안 간선 열거는 격자를 만들지 않는다
+        size_t edges = 0;
+        lattice.for_each_edge(window, [&](size_t fx, size_t fy, size_t tx, size_t ty) {
+            CHECK(window.contains(fx, fy));
+            CHECK(window.contains(tx, ty));
+            ++edges;
+        });
+        CHECK(edges == miura_lattice::edge_count(window));
+
+        CHECK_THROWS_AS(pattern.create_miura_tile(lattice, {9999, 0, 2, 1}), std::logic_error);
+    }
+
+    TEST_CASE("A throwing element factory leaves the pattern unchanged") {
+        const miura_lattice lattice(64, 64);
+        origami_composite<fold_point> pattern;
+        pattern.create_miura_pattern(3, 3);
+        const size_t before = pattern.size();
+        const size_t edges = pattern.edge_count();
+
+        // 창 중간에서 던진다 - 앞서 만든 노드도 붙으면 안 된다
+        const miura_lattice::tile window{10, 20, 30, 20};
+        size_t made = 0;
+        CHECK_THROWS_AS(pattern.create_miura_tile(lattice, window, [&made](size_t x, size_t y) {
+            if (++made == 300) throw std::runtime_error("element failed");
+            return fold_point{static_cast<int>(x), static_cast<int>(y)};
+        }), std::runtime_error);
+
+        CHECK(pattern.size() == before);
+        CHECK(pattern.edge_count() == edges);
+        const auto expected = reference_connections(3, 3);
+        for (size_t i = 0; i < before; ++i) CHECK(connections_of(pattern, i) == expected[i]);
+
+        // 같은 자리에 다시 만들면 정상적으로 붙는다
+        const size_t base = pattern.create_miura_tile(lattice, window, [](size_t x, size_t y) {
+            return fold_point{static_cast<int>(x), static_cast<int>(y)};
+        });
+        CHECK(base == before);
+        CHECK(pattern.size() == before + window.node_count());
+        CHECK(pattern.edge_count() == edges + 2 * miura_lattice::edge_count(window));
+        for (size_t i = base; i < pattern.size(); ++i) {
+            for (size_t to : connections_of(pattern, i)) CHECK(to >= base);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/**
+ * @file tests/unit/test_modern_composite.cpp
+ * @brief 풀 할당 modern_composite / 명시적 스택 순회 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/modern_composite.hpp>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+TEST_SUITE("ORIGAMI modern composite") {
+
+    TEST_CASE("Depth-first traversal visits nodes in pre-order") {
+        modern_composite<std::string> document("Document");
+        document.add_leaf("title");
+
+        auto intro = document.add_composite("Intro");
+        intro.add_leaf("a").add_leaf("b");
+        intro.add_composite("Sub").add_leaf("c");
+
+        document.add_composite("Empty");
+        document.add_leaf("footer");
+
+        std::vector<std::string> seen;
+        document.traverse_depth_first(
+            [&seen](const std::string& leaf) { seen.push_back(leaf); },
+            [&seen](std::string_view name, size_t count) {
+                seen.push_back(std::string(name) + "/" + std::to_string(count));
+            });
+
+        const std::vector<std::string> expected{
+            "Document/4", "title", "Intro/3", "a", "b", "Sub/1", "c", "Empty/0", "footer"};
+        CHECK(seen == expected);
+        CHECK(document.composite_count() == 3);
+        CHECK(intro.name() == "Intro");
+        CHECK(intro.size() == 3);
+    }
+
+    TEST_CASE("Very deep trees traverse and destruct without recursion") {
+        constexpr int depth = 100000;
+        modern_composite<int> chain("Chain");
+
+        auto current = chain.root();
+        for (int i = 0; i < depth; ++i) {
+            current.add_leaf(i);
+            current = current.add_composite("Level");
+        }
+
+        long long leaf_sum = 0;
+        size_t composites = 0;
+        chain.traverse_depth_first([&leaf_sum](int value) { leaf_sum += value; },
+                                   [&composites](std::string_view, size_t) { ++composites; });
+
+        CHECK(composites == depth + 1);
+        CHECK(leaf_sum == static_cast<long long>(depth) * (depth - 1) / 2);
+        CHECK(chain.composite_count() == depth);
+    }
+
+    TEST_CASE("Moves keep node handles valid and reuse pool slots") {
+        modern_composite<int> source("Source");
+        auto section = source.add_composite("Section");
+
+        auto source_root = source.root();
+
+        modern_composite<int> moved(std::move(source));
+        // 루트와 풀이 힙 블록째 옮겨 갔으므로 이동 전 핸들로 노드를 더해도 새 트리에 들어간다
+        section.add_leaf(7);
+        section.add_composite("Nested").add_leaf(5).add_composite("Inner").add_leaf(1);
+        source_root.add_leaf(100);
+        CHECK(moved.composite_count() == 3);
+
+        int total = 0;
+        size_t composites = 0;
+        moved.traverse_depth_first([&total](int value) { total += value; },
+                                   [&composites](std::string_view, size_t) { ++composites; });
+        CHECK(total == 113);
+        CHECK(composites == 4);
+
+        // 이동 대입 후에도 마찬가지
+        modern_composite<int> assigned("Assigned");
+        assigned = std::move(moved);
+        section.add_composite("Late");
+        CHECK(assigned.composite_count() == 4);
+
+        node_pool<std::string, 4> pool;
+        std::string* first = pool.create("first");
+        pool.destroy(first);
+        std::string* second = pool.create("second");
+        CHECK(second == first);
+        CHECK(pool.live() == 1);
+        CHECK(pool.capacity() == 4);
+        pool.destroy(second);
+
+        assigned = modern_composite<int>("Replacement");
+        CHECK(assigned.composite_count() == 0);
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file tests/unit/test_name_table.cpp
+ * @brief 이름 인터닝 테이블 / composite name_id 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/composite.hpp>
+#include <origami/modern_composite.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using row = composite<int_leaf>;
+using sheet = composite<row, int_leaf>;
+
+TEST_SUITE("ORIGAMI name table") {
+
+    TEST_CASE("Equal names share one id") {
+        name_table table;
+        const name_id row_id = table.intern("Row");
+        CHECK(table.intern(std::string("Row")) == row_id);
+        CHECK(table.intern("Cell") != row_id);
+        CHECK(table.resolve(row_id) == "Row");
+        CHECK(table.intern("") == name_id{});
+        CHECK(table.resolve(name_id{}).empty());
+        CHECK(table.size() == 3);
+    }
+
+    TEST_CASE("Resolved names stay valid as the table grows") {
+        name_table table;
+        const name_id first = table.intern("first");
+        const std::string_view view = table.resolve(first);
+
+        std::vector<name_id> ids;
+        for (int i = 0; i < 5000; ++i) ids.push_back(table.intern("name" + std::to_string(i)));
+        const std::string long_name(3000, 'x');
+        const name_id long_id = table.intern(long_name);
+
+        CHECK(view.data() == table.resolve(first).data());
+        CHECK(table.resolve(ids[4321]) == "name4321");
+        CHECK(table.resolve(long_id) == long_name);
+        CHECK(table.intern("name4999") == ids.back());
+    }
+
+    TEST_CASE("Composites store a compact name id") {
+        static_assert(sizeof(name_id) == 4);
+
+        sheet root("Sheet");
+        for (int i = 0; i < 3; ++i) {
+            row current("Row");
+            current.emplace<int_leaf>(i);
+            root.add(std::move(current));
+        }
+
+        const auto& first = std::get<row>(root.children()[0]);
+        const auto& last = std::get<row>(root.children()[2]);
+        CHECK(first.interned_name() == last.interned_name());
+        CHECK(first.name() == "Row");
+
+        root.set_name("Renamed");
+        CHECK(root.name() == "Renamed");
+        CHECK(root.clone()->name() == "Renamed");
+        CHECK(row(first.interned_name()).name() == "Row");
+    }
+
+    TEST_CASE("Modern composite resolves names during traversal") {
+        modern_composite<int> document("Document");
+        document.add_leaf(1);
+
+        std::vector<std::string> names;
+        document.traverse_depth_first([](int) {},
+            [&names](std::string_view name, size_t) { names.emplace_back(name); });
+        CHECK(names == std::vector<std::string>{"Document"});
+    }
+
+    TEST_CASE("Concurrent interning agrees on ids") {
+        std::vector<std::vector<name_id>> results(4);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < results.size(); ++t) {
+            workers.emplace_back([&results, t] {
+                for (int i = 0; i < 2000; ++i) {
+                    results[t].push_back(intern_name("shared" + std::to_string(i % 500)));
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        for (size_t t = 1; t < results.size(); ++t) CHECK(results[t] == results[0]);
+        CHECK(resolve_name(results[0][123]) == "shared123");
+    }
+}
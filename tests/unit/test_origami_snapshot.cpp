@@ -0,0 +1,98 @@
+/**
+ * @file tests/unit/test_origami_snapshot.cpp
+ * @brief origami_composite copy-on-write 스냅샷 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/origami_composite.hpp>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace metaloki::origami;
+
+struct fold_point {
+    int height = 0;
+};
+
+using pattern = origami_composite<fold_point>;
+
+TEST_SUITE("ORIGAMI snapshots") {
+
+    TEST_CASE("Snapshots keep the state at the time they were taken") {
+        pattern miura;
+        miura.create_miura_pattern(4, 3);
+
+        const auto before = miura.take_snapshot();
+        miura.get_element(0).height = 7;
+        const size_t added = miura.add_element();
+        miura.connect(added, 0);
+
+        CHECK(before.size() == 12);
+        CHECK(miura.size() == 13);
+        CHECK(before.get_element(0).height == 0);
+        CHECK(miura.get_element(0).height == 7);
+
+        size_t before_edges = 0;
+        before.visit_connections(0, [&](size_t, size_t, const fold_point&, const fold_point&) { ++before_edges; });
+        size_t after_edges = 0;
+        miura.visit_connections(0, [&](size_t, size_t, const fold_point&, const fold_point&) { ++after_edges; });
+        CHECK(before_edges == after_edges);
+
+        CHECK_THROWS_AS(before.get_element(12), std::logic_error);
+    }
+
+    TEST_CASE("Writes copy only the chunks they touch") {
+        pattern grid;
+        grid.create_miura_pattern(64, 64);
+
+        const auto frozen = grid.take_snapshot();
+        const fold_point* shared_first = &frozen.get_element(0);
+        const fold_point* shared_last = &frozen.get_element(grid.size() - 1);
+
+        grid.get_element(0).height = 1;
+
+        CHECK(&grid.get_element(0) != shared_first);  // 첫 청크는 복사됨
+        CHECK(&std::as_const(grid).get_element(grid.size() - 1) == shared_last);  // 나머지는 공유
+    }
+
+    TEST_CASE("Readers run concurrently with a writer") {
+        pattern grid;
+        grid.create_miura_pattern(32, 32);
+
+        std::atomic<bool> done{false};
+        std::vector<std::thread> readers;
+        std::atomic<size_t> mismatches{0};
+
+        // 스냅샷마다 모든 높이가 동일한 값을 가져야 한다 (쓰기 쪽은 스냅샷 사이에 전체를 갱신)
+        std::vector<pattern::snapshot> published;
+        published.reserve(64);
+        published.push_back(grid.take_snapshot());
+
+        for (int r = 0; r < 2; ++r) {
+            readers.emplace_back([&, copy = published.front()] {
+                while (!done.load()) {
+                    int expected = copy.get_element(0).height;
+                    copy.traverse([&](size_t, const fold_point& point) {
+                        if (point.height != expected) mismatches.fetch_add(1);
+                    });
+                }
+            });
+        }
+
+        for (int round = 1; round < 64; ++round) {
+            for (size_t i = 0; i < grid.size(); ++i) grid.get_element(i).height = round;
+            published.push_back(grid.take_snapshot());
+        }
+        done = true;
+        for (auto& reader : readers) reader.join();
+
+        CHECK(mismatches.load() == 0);
+        for (size_t round = 0; round < published.size(); ++round) {
+            CHECK(published[round].get_element(grid.size() - 1).height == static_cast<int>(round));
+        }
+    }
+}
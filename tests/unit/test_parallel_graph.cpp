@@ -0,0 +1,108 @@
+/**
+ * @file tests/unit/test_parallel_graph.cpp
+ * @brief 병렬 레벨 동기 BFS / 라벨 전파 연결 요소 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/origami_composite.hpp>
+#include <origami/parallel_graph.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace metaloki::origami;
+using namespace metaloki::origami::graph;
+
+// 여러 개의 격자 섬 + 긴 경로 + 외톨이 노드
+static crease_graph make_archipelago() {
+    origami_composite<int> pattern("Archipelago");
+    pattern.create_miura_pattern(40, 30);
+    const miura_lattice island(7, 5);
+    pattern.create_miura_tile(island, island.whole());
+    pattern.add_element(0);
+
+    // 경로는 번호가 큰 쪽에서 작은 쪽으로 이어 라벨이 멀리 전파되게 한다
+    const size_t path_start = pattern.size();
+    for (size_t i = 0; i < 500; ++i) pattern.add_element(static_cast<int>(i));
+    for (size_t i = path_start + 1; i < pattern.size(); ++i) {
+        pattern.connect(i, i - 1);
+        pattern.connect(i - 1, i);
+    }
+    pattern.connect(path_start + 499, 1210);  // 경로 끝을 작은 섬에 연결
+    pattern.connect(1210, path_start + 499);
+    return crease_graph::from(pattern);
+}
+
+TEST_SUITE("ORIGAMI parallel graph") {
+
+    TEST_CASE("Parallel BFS matches serial depths") {
+        const auto g = make_archipelago();
+        for (size_t threads : {1, 2, 4}) {
+            optimization::work_stealing_pool pool(threads);
+            for (size_t grain : {1, 16, 4096}) {
+                parallel_options options;
+                options.pool = &pool;
+                options.grain_size = grain;
+                for (vertex source : {vertex{0}, vertex{615}, vertex{1210}, vertex{1235}, vertex{1600}}) {
+                    CHECK(parallel_bfs(g, source, options) == bfs_depths(g, source));
+                }
+            }
+        }
+        CHECK_THROWS_AS(parallel_bfs(g, static_cast<vertex>(g.node_count())), std::out_of_range);
+    }
+
+    TEST_CASE("Concurrent BFS calls from external threads share a pool") {
+        const auto g = make_archipelago();
+        optimization::work_stealing_pool pool(2);
+        parallel_options options;
+        options.pool = &pool;
+        options.grain_size = 1;
+
+        // 외부 스레드끼리 서로의 fork 작업을 훔쳐 실행해도 결과가 섞이지 않아야 한다
+        const vertex sources[] = {0, 615, 1210, 1600};
+        std::vector<std::vector<std::uint32_t>> results(std::size(sources));
+        {
+            std::vector<std::jthread> callers;
+            for (size_t i = 0; i < std::size(sources); ++i) {
+                callers.emplace_back([&, i] {
+                    for (int round = 0; round < 5; ++round) results[i] = parallel_bfs(g, sources[i], options);
+                });
+            }
+        }
+        for (size_t i = 0; i < std::size(sources); ++i) CHECK(results[i] == bfs_depths(g, sources[i]));
+    }
+
+    TEST_CASE("Parallel components match union-find labels") {
+        const auto g = make_archipelago();
+        const auto expected = connected_components(g);
+        CHECK(expected.count == 3);
+
+        for (size_t threads : {1, 3, 4}) {
+            optimization::work_stealing_pool pool(threads);
+            for (size_t grain : {1, 7, 4096}) {
+                parallel_options options;
+                options.pool = &pool;
+                options.grain_size = grain;
+                const auto labels = parallel_connected_components(g, options);
+                CHECK(labels.count == expected.count);
+                CHECK(labels.label == expected.label);
+            }
+        }
+
+        const auto empty = parallel_connected_components(crease_graph{});
+        CHECK(empty.count == 0);
+        CHECK(empty.label.empty());
+    }
+
+    TEST_CASE("Large implicit lattices on the shared pool") {
+        origami_composite<char> pattern;
+        pattern.create_implicit_miura_pattern(600, 400);
+        const auto g = crease_graph::from(pattern);
+
+        CHECK(parallel_bfs(g, 123456) == bfs_depths(g, 123456));
+        const auto labels = parallel_connected_components(g);
+        CHECK(labels.count == 1);
+    }
+}
@@ -0,0 +1,226 @@
+/**
+ * @file tests/unit/test_parallel_traversal.cpp
+ * @brief composite 병렬 순회/리덕션 및 서브트리 크기 캐시 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/parallel_traversal.hpp>
+#include "section_fixture.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using double_leaf = leaf<double>;
+using section = origami_test::basic_section<int_leaf, double_leaf>;
+using node_variant = section::node_variant;
+
+using document = composite<int_leaf, double_leaf, section>;
+
+// 넓은 최상위 레벨 + 일부 무거운 서브트리
+static document make_document(int sections, int leaves_per_section) {
+    document root("Document");
+    for (int s = 0; s < sections; ++s) {
+        section sec;
+        for (int i = 0; i < leaves_per_section; ++i) {
+            if (i % 4 == 0) {
+                sec.items.push_back(double_leaf(0.1 * i));
+            } else {
+                sec.items.push_back(int_leaf(i));
+            }
+        }
+        if (s % 50 == 0) {
+            section heavy;
+            for (int k = 0; k < 2000; ++k) heavy.items.push_back(int_leaf(1));
+            sec.items.push_back(std::move(heavy));
+        }
+        root.add(std::move(sec));
+    }
+    return root;
+}
+
+static double value_of(const auto& node) {
+    if constexpr (requires { node.value(); }) {
+        return static_cast<double>(node.value());
+    } else {
+        return 0.0;
+    }
+}
+
+static double serial_sum(const document& root) {
+    double sum = 0.0;
+    const auto& children = root.children();
+    detail::for_each_preorder(children.data(), children.data() + children.size(), [&sum](const auto& node) {
+        sum += value_of(node);
+    });
+    return sum;
+}
+
+TEST_SUITE("ORIGAMI parallel traversal") {
+
+    TEST_CASE("Subtree offsets are cached and invalidated on add") {
+        document root("Root");
+        root.add(int_leaf(1));
+
+        section sec;
+        sec.items.push_back(int_leaf(2));
+        sec.items.push_back(int_leaf(3));
+        root.add(std::move(sec));
+
+        CHECK(root.child_subtree_offsets() == std::vector<size_t>{0, 1, 4});
+        CHECK(root.subtree_size() == 5);
+
+        root.emplace<int_leaf>(4);
+        CHECK(root.subtree_size() == 6);
+    }
+
+    TEST_CASE("Nested composites are counted and traversed") {
+        using row = composite<int_leaf>;
+        using table = composite<int_leaf, row>;
+
+        table root("Table");
+        for (int r = 0; r < 10; ++r) {
+            row values("Row");
+            for (int i = 0; i < 1000; ++i) values.emplace<int_leaf>(i);
+            root.add(std::move(values));
+        }
+        root.emplace<int_leaf>(7);
+
+        CHECK(root.subtree_size() == 10012);
+        CHECK(root.child_subtree_offsets()[1] == 1001);
+        CHECK(root.subtree_size() == root.aggregate<aggregates::count>());
+
+        optimization::work_stealing_pool pool(3);
+        parallel_options options;
+        options.pool = &pool;
+        options.grain_size = 64;
+
+        std::atomic<size_t> visited{0};
+        parallel_traverse(root, [&visited](const auto&) { visited.fetch_add(1, std::memory_order_relaxed); }, options);
+        CHECK(visited.load() == 10012);
+
+        for (auto order : {reduction_order::deterministic, reduction_order::unordered}) {
+            options.order = order;
+            const auto sum = parallel_reduce(root, long{0},
+                [](const auto& node) { return static_cast<long>(value_of(node)); },
+                [](long a, long b) { return a + b; },
+                options);
+            CHECK(sum == 10 * 999 * 1000 / 2 + 7);
+        }
+
+        // 중첩 composite 를 직접 바꿔도 dirty 비트를 따라 누적합이 무효화된다
+        auto& first_row = std::get<row>(root.children()[0]);
+        CHECK(root.subtree_size() == 10012);
+        first_row.emplace<int_leaf>(1);
+        CHECK(root.child_subtree_offsets()[1] == 1002);
+        CHECK(root.subtree_size() == 10013);
+    }
+
+    TEST_CASE("parallel_reduce matches the serial result") {
+        const auto root = make_document(400, 100);
+        optimization::work_stealing_pool pool(4);
+
+        parallel_options options;
+        options.pool = &pool;
+        options.grain_size = 256;
+
+        const auto sum = parallel_reduce(root, 0.0,
+            [](const auto& node) { return value_of(node); },
+            [](double a, double b) { return a + b; },
+            options);
+        CHECK(sum == doctest::Approx(serial_sum(root)));
+
+        options.order = reduction_order::unordered;
+        const auto count = parallel_reduce(root, size_t{0},
+            [](const auto&) { return size_t{1}; },
+            [](size_t a, size_t b) { return a + b; },
+            options);
+        CHECK(count == root.subtree_size());
+    }
+
+    TEST_CASE("Concurrent unordered reductions from external threads share a pool") {
+        const auto root = make_document(100, 100);
+        const size_t expected = root.subtree_size();
+        optimization::work_stealing_pool pool(1);
+
+        parallel_options options;
+        options.pool = &pool;
+        options.grain_size = 16;
+        options.order = reduction_order::unordered;
+
+        // 외부 스레드끼리 서로의 fork 작업을 훔쳐 실행해도 누적값이 섞이지 않아야 한다
+        std::atomic<size_t> wrong{0};
+        {
+            std::vector<std::jthread> callers;
+            for (int t = 0; t < 3; ++t) {
+                callers.emplace_back([&] {
+                    for (int round = 0; round < 100; ++round) {
+                        const auto count = parallel_reduce(root, size_t{0},
+                            [](const auto&) { return size_t{1}; },
+                            [](size_t a, size_t b) { return a + b; },
+                            options);
+                        if (count != expected) wrong.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+        }
+        CHECK(wrong.load() == 0);
+    }
+
+    TEST_CASE("Deterministic order gives identical results across pool sizes") {
+        const auto root = make_document(300, 64);
+
+        std::vector<double> results;
+        for (size_t threads : {1, 2, 3, 8}) {
+            optimization::work_stealing_pool pool(threads);
+            parallel_options options;
+            options.pool = &pool;
+            options.grain_size = 100;
+
+            results.push_back(parallel_reduce(root, 0.0,
+                [](const auto& node) { return value_of(node) * 1e-3; },
+                [](double a, double b) { return a + b; },
+                options));
+        }
+
+        for (double result : results) {
+            CHECK(result == results.front());  // 비트 단위 동일
+        }
+    }
+
+    TEST_CASE("parallel_traverse visits every node including the root") {
+        const auto root = make_document(200, 32);
+        optimization::work_stealing_pool pool(3);
+
+        parallel_options options;
+        options.pool = &pool;
+        options.grain_size = 64;
+
+        std::atomic<size_t> visited{0};
+        parallel_traverse(root, [&visited](const auto&) {
+            visited.fetch_add(1, std::memory_order_relaxed);
+        }, options);
+
+        CHECK(visited.load() == root.subtree_size());
+    }
+
+    TEST_CASE("Exceptions from forked work propagate to the caller") {
+        const auto root = make_document(100, 16);
+        optimization::work_stealing_pool pool(2);
+
+        parallel_options options;
+        options.pool = &pool;
+        options.grain_size = 8;
+
+        CHECK_THROWS_AS(parallel_traverse(root, [](const auto& node) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(node)>, double_leaf>) {
+                throw std::runtime_error("visit failed");
+            }
+        }, options), std::runtime_error);
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file tests/unit/test_path_query.cpp
+ * @brief composite 자식 이름 색인 / 경로 질의 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/path_query.hpp>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using string_leaf = leaf<std::string>;
+using para = composite<int_leaf>;
+using section = composite<para, int_leaf>;
+using document = composite<section, string_leaf>;
+
+static document make_document(int sections, int paras) {
+    document root("Doc");
+    root.emplace<string_leaf>("title");
+    for (int s = 0; s < sections; ++s) {
+        section current("section" + std::to_string(s));
+        for (int p = 0; p < paras; ++p) {
+            para paragraph("para" + std::to_string(p));
+            paragraph.emplace<int_leaf>(s * 100 + p);
+            current.add(std::move(paragraph));
+        }
+        current.emplace<int_leaf>(-s);
+        root.add(std::move(current));
+    }
+    return root;
+}
+
+TEST_SUITE("ORIGAMI path query") {
+
+    TEST_CASE("Children are found by name on narrow and wide nodes") {
+        for (int sections : {3, 200}) {
+            const document root = make_document(sections, 2);
+            const auto* found = root.find_child("section2");
+            REQUIRE(found != nullptr);
+            CHECK(std::get<section>(*found).name() == "section2");
+            CHECK(root.find_child("missing") == nullptr);
+            CHECK(root.find_child("title") == nullptr);  // 값 leaf 는 이름이 없다
+        }
+    }
+
+    TEST_CASE("The name index follows structural changes") {
+        document root = make_document(40, 1);
+        CHECK(root.find_child("late") == nullptr);
+
+        root.add(section("late"));
+        CHECK(root.find_child("late") == &root.children().back());
+
+        std::get<section>(root.children()[1]).set_name("renamed");
+        CHECK(root.find_child("section0") == nullptr);
+        CHECK(root.find_child("renamed") == &root.children()[1]);
+
+        // 같은 이름이 여럿이면 앞에서부터 모두
+        root.add(section("late"));
+        std::vector<size_t> positions;
+        root.for_each_child_named(intern_name("late"), [&positions](size_t index) {
+            positions.push_back(index);
+            return true;
+        });
+        CHECK(positions == std::vector<size_t>{41, 42});
+
+        const document copy = root;
+        CHECK(copy.find_child("renamed") == &copy.children()[1]);
+    }
+
+    TEST_CASE("Compiled paths with names and wildcards") {
+        const document root = make_document(30, 5);
+
+        const path_query exact("section7/para3");
+        const para* target = exact.find_first<para>(root);
+        REQUIRE(target != nullptr);
+        CHECK(std::get<int_leaf>(target->children()[0]).value() == 703);
+
+        CHECK(path_query("*/para4").count(root) == 30);
+        CHECK(path_query("section2/*").count(root) == 6);
+        CHECK(path_query("**/para1").count(root) == 30);
+        CHECK(path_query("section1/**").count(root) == 5 + 5 + 1);
+        CHECK(path_query("/section3//para0/").step_count() == 2);
+        CHECK(path_query("section3//para0").count(root) == 1);
+        CHECK(path_query("nowhere/para0").count(root) == 0);
+        CHECK(path_query("").find_first<document>(root) == &root);
+
+        // 조기 중단
+        size_t visited = 0;
+        const bool finished = path_query("**/para2").for_each(root, [&visited](const auto&) {
+            return ++visited < 3;
+        });
+        CHECK_FALSE(finished);
+        CHECK(visited == 3);
+
+        // 값 leaf 도 와일드카드로 얻는다
+        std::vector<int> values;
+        path_query("section4/*/*").for_each(root, [&values](const auto& node) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(node)>, int_leaf>) values.push_back(node.value());
+        });
+        CHECK(values == std::vector<int>{400, 401, 402, 403, 404});
+    }
+}
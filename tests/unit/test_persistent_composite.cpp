@@ -0,0 +1,96 @@
+/**
+ * @file tests/unit/test_persistent_composite.cpp
+ * @brief 구조 공유 persistent_composite 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/persistent_composite.hpp>
+#include <stdexcept>
+#include <string>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using string_leaf = leaf<std::string>;
+using chapter = persistent_composite<int_leaf, string_leaf>;
+using book = persistent_composite<string_leaf, chapter>;
+
+static chapter make_chapter(const std::string& title, int count) {
+    chapter result(title);
+    for (int i = 0; i < count; ++i) result = result.emplace<int_leaf>(i);
+    return result;
+}
+
+static book make_book() {
+    return book("Book")
+        .emplace<string_leaf>("title")
+        .add(make_chapter("one", 3))
+        .add(make_chapter("two", 4));
+}
+
+TEST_SUITE("ORIGAMI persistent composite") {
+
+    TEST_CASE("clone shares the root node") {
+        const auto original = make_book();
+        const auto copy = original.clone();
+
+        CHECK(copy->identical_to(original));
+        CHECK(copy->size() == 3);
+    }
+
+    TEST_CASE("Modifications return new versions and keep the original") {
+        const auto v1 = make_book();
+        const auto v2 = v1.emplace<string_leaf>("appendix");
+        const auto v3 = v2.erase(0).with_name("Renamed");
+
+        CHECK(v1.size() == 3);
+        CHECK(v2.size() == 4);
+        CHECK(v3.size() == 3);
+        CHECK(v1.name() == "Book");
+        CHECK(v3.name() == "Renamed");
+        CHECK(std::holds_alternative<chapter>(v3.children()[0]));
+
+        // 자식 서브트리는 세 버전이 모두 공유
+        CHECK(std::get<chapter>(v1.children()[1]).identical_to(std::get<chapter>(v3.children()[0])));
+    }
+
+    TEST_CASE("update_in copies only the path to the changed node") {
+        const auto v1 = make_book();
+        const auto v2 = v1.update_in({2, 1}, [](const int_leaf& value) {
+            return int_leaf(value.value() + 100);
+        });
+
+        CHECK_FALSE(v2.identical_to(v1));
+        CHECK(std::get<chapter>(v1.children()[1]).identical_to(std::get<chapter>(v2.children()[1])));
+
+        const auto& old_two = std::get<chapter>(v1.children()[2]);
+        const auto& new_two = std::get<chapter>(v2.children()[2]);
+        CHECK_FALSE(new_two.identical_to(old_two));
+        CHECK(std::get<int_leaf>(old_two.children()[1]).value() == 1);
+        CHECK(std::get<int_leaf>(new_two.children()[1]).value() == 101);
+    }
+
+    TEST_CASE("Invalid paths are rejected") {
+        const auto tree = make_book();
+        auto identity = [](const auto& element) { return element; };
+
+        CHECK_THROWS_AS(tree.update_in({7}, identity), std::out_of_range);
+        CHECK_THROWS_AS(tree.update_in({0, 0}, identity), std::invalid_argument);
+        CHECK_THROWS_AS(tree.update_in({1}, [](const int_leaf& value) { return value; }), std::invalid_argument);
+    }
+
+    TEST_CASE("Round trip through a mutable composite") {
+        composite<int_leaf, string_leaf> draft("Draft");
+        draft.emplace<int_leaf>(1);
+        draft.emplace<string_leaf>("two");
+
+        const auto snapshot = chapter::from(draft);
+        draft.emplace<int_leaf>(3);
+
+        CHECK(snapshot.size() == 2);
+        CHECK(snapshot.to_composite().children().size() == 2);
+        CHECK(snapshot.name() == "Draft");
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file tests/unit/test_renderer.cpp
+ * @brief 버퍼링 sink 렌더러 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/renderer.hpp>
+#include "section_fixture.hpp"
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using double_leaf = leaf<double>;
+using string_leaf = leaf<std::string>;
+using row = composite<int_leaf, double_leaf>;
+using section = origami_test::basic_section<int_leaf, string_leaf, row>;
+using node_variant = section::node_variant;
+
+using document = composite<int_leaf, string_leaf, row, section>;
+
+// 버퍼가 찰 때마다 호출 횟수를 세는 sink
+struct counting_sink {
+    std::string text;
+    size_t writes = 0;
+
+    void write(const char* data, size_t size) {
+        text.append(data, size);
+        ++writes;
+    }
+};
+
+static document make_document() {
+    document root("Doc");
+    root.emplace<int_leaf>(1);
+    root.emplace<string_leaf>("say \"hi\"\n");
+
+    section inner;
+    inner.items.push_back(int_leaf(2));
+    section empty;
+    inner.items.push_back(std::move(empty));
+    root.add(std::move(inner));
+
+    row values("Row");
+    values.emplace<double_leaf>(0.25);
+    values.emplace<int_leaf>(-3);
+    root.add(std::move(values));
+    return root;
+}
+
+TEST_SUITE("ORIGAMI renderer") {
+
+    TEST_CASE("JSON output") {
+        std::string out;
+        string_sink sink{out};
+        render_to(sink, make_document());
+
+        CHECK(out == R"({"name":"Doc","children":[1,"say \"hi\"\n",{"children":[2,{"children":[]}]},)"
+                     R"({"name":"Row","children":[0.25,-3]}]})");
+    }
+
+    TEST_CASE("Compact text output") {
+        std::ostringstream stream;
+        render_to(stream, make_document(), render_format::compact_text);
+
+        CHECK(stream.str() == R"(Doc{1,"say \"hi\"\n",{2,{}},Row{0.25,-3}})");
+    }
+
+    TEST_CASE("Large trees stream through a bounded buffer") {
+        composite<int_leaf> wide("Wide");
+        for (int i = 0; i < 100000; ++i) wide.emplace<int_leaf>(i);
+
+        counting_sink sink;
+        render_to(sink, wide, render_format::compact_text, 4096);
+
+        CHECK(sink.text.size() > 500000);
+        CHECK(sink.writes >= sink.text.size() / 4096);
+        CHECK(sink.text.substr(0, 12) == "Wide{0,1,2,3");
+        CHECK(sink.text.back() == '}');
+    }
+
+    TEST_CASE("Deep sections render without recursion") {
+        document root("Deep");
+        section chain;
+        for (int depth = 0; depth < 10000; ++depth) {
+            section parent;
+            parent.items.push_back(std::move(chain));
+            chain = std::move(parent);
+        }
+        root.add(std::move(chain));
+
+        std::string out;
+        string_sink sink{out};
+        render_to(sink, root, render_format::compact_text);
+        CHECK(out.size() == 4 + 2 + 2 * 10001);
+    }
+
+    TEST_CASE("Origami patterns render as JSON and text") {
+        origami_composite<int> pattern("Grid");
+        pattern.create_miura_pattern(2, 2);
+
+        std::string json;
+        string_sink sink{json};
+        render_to(sink, pattern);
+        CHECK(json.rfind(R"({"pattern":"Grid","nodes":[{"id":0,"element":0,"connections":[1,2,3]})", 0) == 0);
+
+        std::string text;
+        string_sink text_sink{text};
+        render_to(text_sink, pattern, render_format::compact_text);
+        CHECK(text.rfind("Origami Pattern 'Grid' with 4 elements\nNode 0: 0 -> Connections: 1 2 3 \n", 0) == 0);
+    }
+}
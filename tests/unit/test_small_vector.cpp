@@ -0,0 +1,158 @@
+/**
+ * @file tests/unit/test_small_vector.cpp
+ * @brief 인라인 자식 저장소(small_vector) / basic_composite 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/composite.hpp>
+#include <origami/modern_composite.hpp>
+#include <origami/renderer.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using string_leaf = leaf<std::string>;
+
+// 생성/파괴 수를 세는 요소
+struct tracked {
+    static inline int alive = 0;
+    int value;
+
+    tracked(int v = 0) : value(v) { ++alive; }
+    tracked(const tracked& other) : value(other.value) { ++alive; }
+    tracked(tracked&& other) noexcept : value(other.value) { ++alive; }
+    tracked& operator=(const tracked&) = default;
+    tracked& operator=(tracked&&) noexcept = default;
+    ~tracked() { --alive; }
+
+    friend bool operator==(const tracked& a, const tracked& b) { return a.value == b.value; }
+};
+
+static std::vector<int> values_of(const small_vector<tracked, 3>& v) {
+    std::vector<int> out;
+    for (const auto& item : v) out.push_back(item.value);
+    return out;
+}
+
+TEST_SUITE("ORIGAMI small vector") {
+
+    TEST_CASE("Elements stay inline until the capacity is exceeded") {
+        small_vector<tracked, 3> v;
+        CHECK(v.is_inline());
+        for (int i = 0; i < 3; ++i) v.emplace_back(i);
+        CHECK(v.is_inline());
+        CHECK(v.capacity() == 3);
+
+        v.push_back(v[0]);  // 자기 요소 참조 + 재할당
+        CHECK_FALSE(v.is_inline());
+        CHECK(values_of(v) == std::vector<int>{0, 1, 2, 0});
+        CHECK(tracked::alive == 4);
+    }
+
+    TEST_CASE("Copy, move and assignment preserve contents in both modes") {
+        {
+            small_vector<tracked, 3> inline_vector{1, 2};
+            small_vector<tracked, 3> heap_vector{1, 2, 3, 4, 5};
+
+            small_vector<tracked, 3> copy = heap_vector;
+            CHECK(copy == heap_vector);
+
+            small_vector<tracked, 3> moved_inline = std::move(inline_vector);
+            CHECK(moved_inline.is_inline());
+            CHECK(values_of(moved_inline) == std::vector<int>{1, 2});
+            CHECK(inline_vector.empty());
+
+            const tracked* heap_data = heap_vector.data();
+            small_vector<tracked, 3> moved_heap = std::move(heap_vector);
+            CHECK(moved_heap.data() == heap_data);
+            CHECK(heap_vector.is_inline());
+
+            moved_inline = std::move(moved_heap);
+            CHECK(values_of(moved_inline) == std::vector<int>{1, 2, 3, 4, 5});
+            moved_inline = copy;
+            moved_inline.swap(moved_heap);
+            CHECK(values_of(moved_heap) == std::vector<int>{1, 2, 3, 4, 5});
+        }
+        CHECK(tracked::alive == 0);
+    }
+
+    TEST_CASE("Inserting a range of its own elements") {
+        {
+            // 재할당이 필요한 경우와 아닌 경우 모두
+            small_vector<tracked, 3> v{1, 2};
+            v.insert(v.begin() + 1, v.begin(), v.end());
+            CHECK(values_of(v) == std::vector<int>{1, 1, 2, 2});
+            v.insert(v.end(), v.begin(), v.end());
+            CHECK(values_of(v) == std::vector<int>{1, 1, 2, 2, 1, 1, 2, 2});
+
+            v.reserve(32);
+            v.insert(v.begin(), v.begin() + 2, v.begin() + 5);
+            CHECK(values_of(v) == std::vector<int>{2, 2, 1, 1, 1, 2, 2, 1, 1, 2, 2});
+        }
+        CHECK(tracked::alive == 0);
+
+        composite<int_leaf> row("Row");
+        row.emplace<int_leaf>(1);
+        row.emplace<int_leaf>(2);
+        for (int i = 0; i < 3; ++i) row.append_range(std::as_const(row).children());
+        REQUIRE(row.children().size() == 16);
+        CHECK(std::get<int_leaf>(row.children()[15]).value() == 2);
+        CHECK(std::get<int_leaf>(row.children()[14]).value() == 1);
+    }
+
+    TEST_CASE("Insert and erase keep order") {
+        {
+            small_vector<tracked, 3> v{1, 5};
+            const std::vector<tracked> middle{2, 3, 4};
+            v.insert(v.begin() + 1, middle.begin(), middle.end());
+            CHECK(values_of(v) == std::vector<int>{1, 2, 3, 4, 5});
+
+            v.insert(v.begin(), tracked(0));
+            v.erase(v.begin() + 2, v.begin() + 4);
+            CHECK(values_of(v) == std::vector<int>{0, 1, 4, 5});
+
+            v.resize(2);
+            CHECK(values_of(v) == std::vector<int>{0, 1});
+            v.pop_back();
+            CHECK(v.back().value == 0);
+        }
+        CHECK(tracked::alive == 0);
+    }
+
+    TEST_CASE("Composites keep small child lists inside the node") {
+        using small_row = composite<int_leaf>;
+        static_assert(small_row::inline_children == 4);
+
+        using heap_only = basic_composite<0, int_leaf>;
+        static_assert(sizeof(heap_only) < sizeof(small_row));
+
+        small_row row("Row");
+        for (int i = 0; i < 4; ++i) row.emplace<int_leaf>(i);
+        CHECK(row.children().is_inline());
+        row.emplace<int_leaf>(4);
+        CHECK_FALSE(row.children().is_inline());
+
+        // 인라인 자식을 가진 중첩 composite 도 이동 후 집계가 맞아야 한다
+        using custom = basic_composite<2, small_row, int_leaf>;
+        custom table("Table");
+        for (int r = 0; r < 3; ++r) {
+            small_row current("Row");
+            current.emplace<int_leaf>(r);
+            table.add(std::move(current));
+        }
+        CHECK(table.aggregate<aggregates::count>() == 7);
+        CHECK(table.clone()->children().size() == 3);
+
+        std::string json;
+        string_sink sink{json};
+        render_to(sink, table);
+        CHECK(json == R"({"name":"Table","children":[{"name":"Row","children":[0]},)"
+                      R"({"name":"Row","children":[1]},{"name":"Row","children":[2]}]})");
+    }
+}
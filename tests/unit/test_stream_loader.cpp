@@ -0,0 +1,213 @@
+/**
+ * @file tests/unit/test_stream_loader.cpp
+ * @brief 스트리밍 점진 로더 (pull parser) 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/renderer.hpp>
+#include <origami/stream_loader.hpp>
+#include <cstdio>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using double_leaf = leaf<double>;
+using string_leaf = leaf<std::string>;
+using row = composite<int_leaf, double_leaf>;
+using sheet = composite<string_leaf, row, int_leaf>;
+
+static sheet make_sheet() {
+    sheet result("Sheet");
+    result.emplace<string_leaf>("header \"quoted\"\n");
+    for (int r = 0; r < 3; ++r) {
+        row current("Row" + std::to_string(r));
+        for (int c = 0; c < 4; ++c) current.emplace<int_leaf>(r * 10 + c);
+        current.emplace<double_leaf>(0.5 * r);
+        result.add(std::move(current));
+    }
+    result.emplace<int_leaf>(-7);
+    return result;
+}
+
+static std::string to_json(const sheet& tree) {
+    std::string out;
+    string_sink sink{out};
+    render_to(sink, tree);
+    return out;
+}
+
+// 읽은 바이트 수를 세는 소스
+struct counting_source {
+    memory_source inner;
+    size_t consumed = 0;
+
+    size_t read(char* buffer, size_t capacity) {
+        const size_t count = inner.read(buffer, capacity);
+        consumed += count;
+        return count;
+    }
+};
+
+TEST_SUITE("ORIGAMI stream loader") {
+
+    TEST_CASE("Events arrive in document order through a tiny buffer") {
+        const std::string json = R"({"name":"Doc","children":[1,"aé",{"children":[]},true,null,2.5]})";
+        memory_source source(json);
+        tree_reader reader(source, 16);
+
+        std::vector<std::string> seen;
+        while (reader.next()) {
+            const auto& event = reader.current();
+            switch (event.type) {
+                case tree_event::kind::begin_node:
+                    seen.push_back("begin:" + std::string(event.name) + "@" + std::to_string(event.depth));
+                    break;
+                case tree_event::kind::end_node:
+                    seen.push_back("end@" + std::to_string(event.depth));
+                    break;
+                case tree_event::kind::value:
+                    std::visit([&seen](const auto& value) {
+                        using value_type = std::decay_t<decltype(value)>;
+                        if constexpr (std::is_same_v<value_type, std::monostate>) seen.push_back("null");
+                        else if constexpr (std::is_same_v<value_type, std::string_view>) seen.push_back(std::string(value));
+                        else seen.push_back(std::to_string(value));
+                    }, event.value);
+                    break;
+            }
+        }
+
+        const std::vector<std::string> expected{
+            "begin:Doc@0", "1", "a\xC3\xA9", "begin:@1", "end@1", "1", "null", "2.500000", "end@0"};
+        CHECK(seen == expected);
+    }
+
+    TEST_CASE("Rendered trees load back through a file descriptor") {
+        const sheet original = make_sheet();
+        const std::string json = to_json(original);
+
+        const std::string path = "test_stream_loader.json";
+        {
+            std::FILE* file = std::fopen(path.c_str(), "wb");
+            REQUIRE(file != nullptr);
+            file_sink sink{file};
+            render_to(sink, original);
+            std::fclose(file);
+        }
+
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        REQUIRE(fd >= 0);
+        fd_source source(fd);
+        tree_reader reader(source, 64);
+        const sheet loaded = load_composite<sheet>(reader);
+        ::close(fd);
+        std::remove(path.c_str());
+
+        CHECK(loaded.name() == "Sheet");
+        REQUIRE(loaded.children().size() == 5);
+        CHECK(std::get<string_leaf>(loaded.children()[0]).value() == "header \"quoted\"\n");
+        const auto& second = std::get<row>(loaded.children()[2]);
+        CHECK(second.name() == "Row1");
+        CHECK(std::get<int_leaf>(second.children()[3]).value() == 13);
+        CHECK(std::get<double_leaf>(second.children()[4]).value() == 0.5);
+        CHECK(std::get<int_leaf>(loaded.children()[4]).value() == -7);
+        CHECK(to_json(loaded) == json);
+    }
+
+    TEST_CASE("A subtree loads by path and reading stops there") {
+        sheet big("Sheet");
+        for (int r = 0; r < 200; ++r) {
+            row current("Row" + std::to_string(r));
+            for (int c = 0; c < 50; ++c) current.emplace<int_leaf>(c);
+            big.add(std::move(current));
+        }
+        const std::string json = to_json(big);
+
+        counting_source source{memory_source(json)};
+        tree_reader reader(source, 256);
+        const auto target = load_subtree<row>(reader, {"Sheet", "Row3"});
+
+        REQUIRE(target.has_value());
+        CHECK(target->name() == "Row3");
+        CHECK(target->children().size() == 50);
+        CHECK(source.consumed < json.size() / 10);
+
+        memory_source missing_source(json);
+        tree_reader missing(missing_source, 256);
+        CHECK_FALSE(load_subtree<row>(missing, {"Sheet", "Row999"}).has_value());
+    }
+
+    TEST_CASE("Callers can stop early and skip subtrees") {
+        const std::string json = to_json(make_sheet());
+        counting_source source{memory_source(json)};
+        tree_reader reader(source, 32);
+
+        REQUIRE(reader.next());
+        CHECK(reader.current().name == "Sheet");
+        REQUIRE(reader.next());
+        CHECK(reader.current().type == tree_event::kind::value);
+
+        size_t skipped = 0;
+        while (reader.next() && reader.current().type == tree_event::kind::begin_node) {
+            reader.skip_subtree();
+            ++skipped;
+        }
+        CHECK(skipped == 3);
+        CHECK(std::get<std::int64_t>(reader.current().value) == -7);
+        CHECK(reader.next());
+        CHECK(reader.current().type == tree_event::kind::end_node);
+        CHECK_FALSE(reader.next());
+    }
+
+    TEST_CASE("Nested composite types load in place") {
+        using book = composite<string_leaf, sheet>;
+        book source_tree("Book");
+        source_tree.add(make_sheet());
+        source_tree.emplace<string_leaf>("end");
+        source_tree.add(make_sheet());
+
+        std::string json;
+        string_sink sink{json};
+        render_to(sink, source_tree);
+
+        memory_source source(json);
+        tree_reader reader(source, 32);
+        const auto loaded = load_composite<book>(reader);
+        REQUIRE(loaded.children().size() == 3);
+        CHECK(loaded.subtree_size() == source_tree.subtree_size());
+        const auto& second = std::get<sheet>(loaded.children()[2]);
+        CHECK(to_json(second) == to_json(make_sheet()));
+        CHECK(std::get<row>(second.children()[2]).name() == "Row1");
+    }
+
+    TEST_CASE("Malformed input is rejected") {
+        for (std::string_view bad : {R"({"name":"A","children":[1,2)", R"({"name":"A","children":[1 2]})",
+                                     R"({"name":"A","children":["open]})", R"([1,2])"}) {
+            memory_source source(bad);
+            tree_reader reader(source, 16);
+            CHECK_THROWS_AS(load_composite<row>(reader), std::runtime_error);
+        }
+
+        // 짝이 맞지 않는 서로게이트
+        for (std::string_view bad : {R"({"name":"A","children":["\ud83d\u0041"]})", R"({"name":"A","children":["\ude00"]})",
+                                     R"({"name":"A","children":["\ud83dx"]})"}) {
+            memory_source source(bad);
+            tree_reader reader(source, 16);
+            CHECK_THROWS_AS(load_composite<sheet>(reader), std::runtime_error);
+        }
+        memory_source emoji_source(R"({"name":"A","children":["\ud83d\ude00"]})");
+        tree_reader emoji(emoji_source, 16);
+        const auto loaded = load_composite<sheet>(emoji);
+        CHECK(std::get<string_leaf>(loaded.children()[0]).value() == "\xF0\x9F\x98\x80");
+
+        // 루트 뒤의 데이터는 끝까지 읽을 때 드러난다
+        memory_source trailing_source(R"({"name":"A","children":[]} extra)");
+        tree_reader trailing(trailing_source, 16);
+        CHECK_THROWS_AS(while (trailing.next()) {}, std::runtime_error);
+    }
+}
@@ -0,0 +1,221 @@
+/**
+ * @file tests/unit/test_tree_iterator.cpp
+ * @brief ORIGAMI tree_iterator / origami_iterator 순회 순서 및 할당 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/tree_iterator.hpp>
+#include <origami/iterator.hpp>
+#include "section_fixture.hpp"
+#include <algorithm>
+#include <ranges>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+// 할당 횟수 추적 (zero-allocation 순회 검증용)
+static size_t allocation_count = 0;
+
+void* operator new(std::size_t size) {
+    ++allocation_count;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc{};
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+using int_leaf = leaf<int>;
+using section = origami_test::basic_section<int_leaf>;
+using node_variant = section::node_variant;
+
+using document = composite<int_leaf, section>;
+using iterator = tree_iterator<int_leaf, section>;
+
+// 원소를 문자열 토큰으로 변환 ("S" = section, 숫자 = leaf)
+static std::vector<std::string> tokens_of(iterator iter) {
+    std::vector<std::string> tokens;
+    iter.for_each([&tokens](const auto& element) {
+        if constexpr (requires { element.value(); }) {
+            tokens.push_back(std::to_string(element.value()));
+        } else {
+            tokens.push_back("S");
+        }
+    });
+    return tokens;
+}
+
+// root { S{1, 2, S{3}}, 4 }
+static document make_sample() {
+    section inner;
+    inner.items.push_back(int_leaf(3));
+
+    section outer;
+    outer.items.push_back(int_leaf(1));
+    outer.items.push_back(int_leaf(2));
+    outer.items.push_back(std::move(inner));
+
+    document root("Root");
+    root.add(std::move(outer));
+    root.add(int_leaf(4));
+    return root;
+}
+
+TEST_SUITE("ORIGAMI tree_iterator") {
+
+    TEST_CASE("Preorder DFS visits parents before children") {
+        auto root = make_sample();
+        CHECK(tokens_of(iterator(&root)) == std::vector<std::string>{"S", "1", "2", "S", "3", "4"});
+    }
+
+    TEST_CASE("BFS visits level by level") {
+        auto root = make_sample();
+        iterator iter(&root, iterator::traversal_order::breadth_first);
+        CHECK(tokens_of(iter) == std::vector<std::string>{"S", "4", "1", "2", "S", "3"});
+    }
+
+    TEST_CASE("Postorder DFS visits children before parents") {
+        auto root = make_sample();
+        iterator iter(&root, iterator::traversal_order::depth_first_postorder);
+        CHECK(tokens_of(iter) == std::vector<std::string>{"1", "2", "3", "S", "S", "4"});
+    }
+
+    TEST_CASE("Inorder DFS visits first subtree, node, then remaining subtrees") {
+        // root { S{1, S{2, 3}}, 4 } - 이진 트리: 1 S 2 S 3 4
+        section right;
+        right.items.push_back(int_leaf(2));
+        right.items.push_back(int_leaf(3));
+
+        section top;
+        top.items.push_back(int_leaf(1));
+        top.items.push_back(std::move(right));
+
+        document root("Binary");
+        root.add(std::move(top));
+        root.add(int_leaf(4));
+
+        iterator iter(&root, iterator::traversal_order::depth_first_inorder);
+        CHECK(tokens_of(iter) == std::vector<std::string>{"1", "S", "2", "S", "3", "4"});
+    }
+
+    TEST_CASE("Level order reports node depths") {
+        auto root = make_sample();
+        iterator iter(&root, iterator::traversal_order::breadth_first);
+
+        std::vector<size_t> depths;
+        iter.for_each_with_depth([&depths](const auto&, size_t depth) {
+            depths.push_back(depth);
+        });
+        CHECK(depths == std::vector<size_t>{1, 1, 2, 2, 2, 3});
+    }
+
+    TEST_CASE("tree_iterator is a forward range usable with std::ranges") {
+        static_assert(std::forward_iterator<iterator::iterator>);
+        static_assert(std::ranges::forward_range<iterator>);
+
+        auto root = make_sample();
+        const iterator preorder(&root);
+
+        const auto leaves = std::ranges::count_if(preorder, [](const node_variant& node) {
+            return std::holds_alternative<int_leaf>(node);
+        });
+        CHECK(leaves == 4);
+
+        // 복사본은 독립적으로 진행 (multi-pass)
+        auto first = preorder.begin();
+        auto second = first;
+        ++first;
+        CHECK(std::holds_alternative<section>(*second));
+        CHECK(first != second);
+
+        // 후위 순회 range 의 마지막 원소
+        const iterator postorder(&root, iterator::traversal_order::depth_first_postorder);
+        auto last = std::ranges::find_if(postorder, [](const node_variant& node) {
+            return std::holds_alternative<int_leaf>(node) && std::get<int_leaf>(node).value() == 4;
+        });
+        CHECK(std::next(last) == postorder.end());
+    }
+
+    TEST_CASE("origami_iterator walks past the first subtree") {
+        static_assert(std::forward_iterator<origami_iterator<const node_variant>>);
+
+        section tree;
+        tree.items.push_back(int_leaf(1));
+        tree.items.push_back(section{});
+        std::get<section>(tree.items.back()).items.push_back(int_leaf(2));
+        tree.items.push_back(int_leaf(3));
+
+        const node_variant root = std::move(tree);
+        std::vector<int> values;
+        size_t visited = 0;
+        for (origami_iterator<const node_variant> it(&root), end; it != end; ++it) {
+            ++visited;
+            if (const auto* value = std::get_if<int_leaf>(&*it)) values.push_back(value->value());
+        }
+
+        CHECK(visited == 5);
+        CHECK(values == std::vector<int>{1, 2, 3});
+    }
+
+    TEST_CASE("Reset restarts traversal") {
+        auto root = make_sample();
+        iterator iter(&root);
+        while (iter.has_next()) iter.next();
+
+        iter.reset();
+        CHECK(iter.has_next());
+        CHECK(tokens_of(iter).size() == 6);
+    }
+
+    TEST_CASE("Empty composite has nothing to iterate") {
+        document root("Empty");
+        iterator iter(&root);
+        CHECK_FALSE(iter.has_next());
+        CHECK_THROWS_AS(iter.next(), std::runtime_error);
+    }
+
+    TEST_CASE("DFS construction and traversal perform no allocations") {
+        document root("Large");
+        for (int s = 0; s < 100; ++s) {
+            section sec;
+            for (int i = 0; i < 100; ++i) sec.items.push_back(int_leaf(i));
+            root.add(std::move(sec));
+        }
+
+        const size_t before = allocation_count;
+        iterator iter(&root);
+        size_t visited = 0;
+        iter.for_each([&visited](const auto&) { ++visited; });
+
+        CHECK(visited == 100 + 100 * 100);
+        CHECK(allocation_count == before);
+    }
+
+    TEST_CASE("Trees deeper than the inline depth still traverse correctly") {
+        section deep;
+        section* cursor = &deep;
+        const size_t depth = iterator::inline_depth * 3;
+        for (size_t d = 0; d < depth; ++d) {
+            cursor->items.push_back(int_leaf(static_cast<int>(d)));
+            cursor->items.push_back(section{});
+            cursor = &std::get<section>(cursor->items.back());
+        }
+
+        document root("Deep");
+        root.add(std::move(deep));
+
+        int sum = 0;
+        size_t visited = 0;
+        iterator(&root).for_each([&](const auto& element) {
+            ++visited;
+            if constexpr (requires { element.value(); }) sum += element.value();
+        });
+
+        CHECK(visited == 1 + depth * 2);
+        CHECK(sum == static_cast<int>(depth * (depth - 1) / 2));
+    }
+}
@@ -0,0 +1,115 @@
+/**
+ * @file tests/unit/test_tree_views.cpp
+ * @brief ORIGAMI composite 트리 ranges view 어댑터 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/tree_views.hpp>
+#include "section_fixture.hpp"
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using string_leaf = leaf<std::string>;
+using section = origami_test::basic_section<int_leaf, string_leaf>;
+using node_variant = section::node_variant;
+
+using document = iterable_composite<int_leaf, string_leaf, section>;
+
+// root { S{0..9, "title"}, S{10..19, "title"}, ... } - 섹션 10개
+static document make_document() {
+    document root("Document");
+    for (int s = 0; s < 10; ++s) {
+        section sec;
+        for (int i = 0; i < 10; ++i) sec.items.push_back(int_leaf(s * 10 + i));
+        sec.items.push_back(string_leaf("title"));
+        root.add(std::move(sec));
+    }
+    return root;
+}
+
+TEST_SUITE("ORIGAMI tree views") {
+
+    TEST_CASE("Views model std::ranges::view") {
+        auto root = make_document();
+
+        static_assert(std::ranges::view<decltype(views::dfs(root))>);
+        static_assert(std::ranges::forward_range<decltype(views::dfs(root))>);
+        static_assert(std::ranges::borrowed_range<decltype(views::bfs(root))>);
+        static_assert(std::ranges::view<decltype(root | views::with_depth)>);
+        static_assert(std::ranges::view<decltype(root | views::leaves_of<int_leaf>)>);
+    }
+
+    TEST_CASE("dfs and bfs cover the whole tree") {
+        auto root = make_document();
+
+        CHECK(std::ranges::distance(views::dfs(root)) == 10 + 10 * 11);
+        CHECK(std::ranges::distance(root | views::bfs) == 10 + 10 * 11);
+
+        // BFS 는 모든 섹션을 먼저 방문
+        CHECK(std::ranges::all_of(root | views::bfs | std::views::take(10), [](const node_variant& node) {
+            return std::holds_alternative<section>(node);
+        }));
+    }
+
+    TEST_CASE("leaves_of pipelines are lazy and short-circuit") {
+        auto root = make_document();
+
+        std::vector<int> doubled;
+        for (int value : root
+                         | views::leaves_of<int_leaf>
+                         | std::views::transform([](const int_leaf& leaf) { return leaf.value() * 2; })
+                         | std::views::take(12)) {
+            doubled.push_back(value);
+        }
+
+        REQUIRE(doubled.size() == 12);
+        CHECK(doubled.front() == 0);
+        CHECK(doubled.back() == 22);  // 첫 섹션의 문자열 노드는 건너뜀
+
+        CHECK(std::ranges::distance(root | views::leaves_of<string_leaf>) == 10);
+    }
+
+    TEST_CASE("with_depth reports each node's depth") {
+        auto root = make_document();
+
+        size_t sections = 0;
+        size_t leaves = 0;
+        for (auto [node, depth] : root | views::with_depth) {
+            if (depth == 1) {
+                CHECK(std::holds_alternative<section>(node));
+                ++sections;
+            } else {
+                CHECK(depth == 2);
+                ++leaves;
+            }
+        }
+        CHECK(sections == 10);
+        CHECK(leaves == 110);
+
+        auto level_order = views::with_depth(root, traversal_order::breadth_first);
+        CHECK((*std::ranges::next(level_order.begin(), 10)).depth == 2);
+    }
+
+    TEST_CASE("Views work with a custom inline capacity") {
+        using wide_row = basic_composite<8, int_leaf>;
+        wide_row row("Row");
+        for (int i = 0; i < 12; ++i) row.emplace<int_leaf>(i);
+        static_assert(wide_row::inline_children == 8);
+
+        CHECK(std::ranges::distance(views::dfs(row)) == 12);
+        CHECK(std::ranges::distance(row | views::bfs) == 12);
+
+        int expected = 0;
+        for (const int_leaf& value : row | views::leaves_of<int_leaf>) CHECK(value.value() == expected++);
+        for (auto [node, depth] : row | views::with_depth) CHECK(depth == 1);
+
+        basic_tree_iterator<wide_row> iter(&row, traversal_order::breadth_first);
+        CHECK(std::get<int_leaf>(iter.next()).value() == 0);
+    }
+}
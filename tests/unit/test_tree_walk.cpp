@@ -0,0 +1,131 @@
+/**
+ * @file tests/unit/test_tree_walk.cpp
+ * @brief composite::walk / traverse 반복 순회 엔진 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/composite.hpp>
+#include "section_fixture.hpp"
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+
+using section = origami_test::basic_section<int_leaf>;
+using node_variant = section::node_variant;
+
+using para = composite<int_leaf>;
+using document = composite<para, int_leaf, section>;
+
+// 노드를 토큰으로 ("S" = section, 이름 = composite, 숫자 = leaf)
+template<typename Node>
+static std::string token_of(const Node& node) {
+    if constexpr (requires { node.value(); }) {
+        return std::to_string(node.value());
+    } else if constexpr (requires { node.name(); }) {
+        return std::string(node.name());
+    } else {
+        return "S";
+    }
+}
+
+static document make_document() {
+    document root("Doc");
+    para first("p");
+    first.add(int_leaf(1));
+    first.add(int_leaf(2));
+    root.add(std::move(first));
+    root.add(int_leaf(3));
+
+    section nested;
+    nested.items.push_back(int_leaf(4));
+    section inner;
+    inner.items.push_back(int_leaf(5));
+    nested.items.push_back(std::move(inner));
+    root.add(std::move(nested));
+    return root;
+}
+
+TEST_SUITE("ORIGAMI tree walk") {
+
+    TEST_CASE("Pre and post callbacks bracket every subtree") {
+        const document root = make_document();
+
+        std::vector<std::string> events;
+        const bool finished = root.walk(
+            [&events](const auto& node) { events.push_back(token_of(node)); },
+            [&events](const auto& node) { events.push_back("/" + token_of(node)); });
+
+        CHECK(finished);
+        const std::vector<std::string> expected{
+            "Doc", "p", "1", "/1", "2", "/2", "/p", "3", "/3",
+            "S", "4", "/4", "S", "5", "/5", "/S", "/S", "/Doc"};
+        CHECK(events == expected);
+
+        // traverse 는 같은 전위 순서
+        std::vector<std::string> visited;
+        root.traverse([&visited](const auto& node) { visited.push_back(token_of(node)); });
+        CHECK(visited == std::vector<std::string>{"Doc", "p", "1", "2", "3", "S", "4", "S", "5"});
+    }
+
+    TEST_CASE("Callbacks can skip subtrees or stop") {
+        const document root = make_document();
+
+        std::vector<std::string> visited;
+        root.walk([&visited](const auto& node) {
+            visited.push_back(token_of(node));
+            if constexpr (requires { node.items; }) {
+                return traverse_action::skip_subtree;
+            } else {
+                return traverse_action::proceed;
+            }
+        });
+        CHECK(visited == std::vector<std::string>{"Doc", "p", "1", "2", "3", "S"});
+
+        size_t seen = 0;
+        const bool finished = root.walk([&seen](const auto&) {
+            return ++seen == 4 ? traverse_action::stop : traverse_action::proceed;
+        });
+        CHECK_FALSE(finished);
+        CHECK(seen == 4);
+
+        // post 에서 멈추기
+        std::vector<std::string> closed;
+        CHECK_FALSE(root.walk([](const auto&) {}, [&closed](const auto& node) {
+            closed.push_back(token_of(node));
+            return closed.size() == 3 ? traverse_action::stop : traverse_action::proceed;
+        }));
+        CHECK(closed == std::vector<std::string>{"1", "2", "p"});
+    }
+
+    TEST_CASE("100k-deep chains walk without recursion") {
+        constexpr int depth = 100000;
+        section chain;
+        chain.items.push_back(int_leaf(7));
+        for (int i = 0; i < depth; ++i) {
+            section parent;
+            parent.items.push_back(std::move(chain));
+            chain = std::move(parent);
+        }
+
+        document root("Deep");
+        root.add(std::move(chain));
+
+        size_t nodes = 0;
+        size_t closed = 0;
+        int leaf_value = 0;
+        CHECK(root.walk(
+            [&](const auto& node) {
+                ++nodes;
+                if constexpr (requires { node.value(); }) leaf_value = node.value();
+            },
+            [&closed](const auto&) { ++closed; }));
+        CHECK(nodes == depth + 3);
+        CHECK(closed == nodes);
+        CHECK(leaf_value == 7);
+    }
+}
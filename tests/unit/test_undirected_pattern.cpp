@@ -0,0 +1,187 @@
+/**
+ * @file tests/unit/test_undirected_pattern.cpp
+ * @brief origami_composite 무방향 저장 / 중복 연결 거부 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/origami_composite.hpp>
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace metaloki::origami;
+
+template<typename Pattern>
+static std::vector<size_t> sorted_connections(const Pattern& pattern, size_t index) {
+    std::vector<size_t> result;
+    pattern.visit_connections(index, [&result](size_t, size_t to, const auto&, const auto&) { result.push_back(to); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template<typename Pattern>
+static void check_same_topology(const Pattern& actual, const origami_composite<int>& expected) {
+    REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        CHECK(sorted_connections(actual, i) == sorted_connections(expected, i));
+    }
+}
+
+static const edge_options undirected{edge_mode::undirected, false};
+static const edge_options undirected_unique{edge_mode::undirected, true};
+
+TEST_SUITE("ORIGAMI undirected pattern") {
+
+    TEST_CASE("Undirected Miura patterns store each crease once") {
+        origami_composite<int> directed;
+        directed.create_miura_pattern(13, 9);
+
+        for (const auto& options : {undirected, undirected_unique}) {
+            origami_composite<int> pattern("Miura", options);
+            pattern.create_miura_pattern(13, 9);
+            CHECK(pattern.is_undirected());
+
+            // 저장 항목은 절반, 첫 방문 뒤에는 역방향 색인이 더해진다
+            const size_t stored = pattern.edge_memory();
+            CHECK(2 * stored <= directed.edge_memory());
+            check_same_topology(pattern, directed);
+            CHECK(pattern.edge_memory() > stored);
+            CHECK(pattern.edge_memory() < directed.edge_memory());
+
+            const miura_lattice lattice(13, 9);
+            CHECK(pattern.edge_count() == lattice.edge_count());
+            CHECK(directed.edge_count() == lattice.connection_count());
+
+            size_t creases = 0;
+            pattern.for_each_edge([&creases](size_t from, size_t to, const int&, const int&) {
+                CHECK(from < to);
+                ++creases;
+            });
+            CHECK(creases == lattice.edge_count());
+
+            // 스냅샷과 복제본도 양 끝에서 본다
+            check_same_topology(pattern.take_snapshot(), directed);
+            check_same_topology(*pattern.clone(), directed);
+            CHECK(pattern.degree(lattice.index(6, 4)) == directed.degree(lattice.index(6, 4)));
+        }
+    }
+
+    TEST_CASE("connect stores once and is visited from both ends") {
+        origami_composite<int> pattern("Triangle", undirected);
+        for (int i = 0; i < 4; ++i) pattern.add_element(i);
+        pattern.connect(2, 0);
+        pattern.connect(1, 2);
+        pattern.connect(3, 3);
+
+        CHECK(sorted_connections(pattern, 0) == std::vector<size_t>{2});
+        CHECK(sorted_connections(pattern, 1) == std::vector<size_t>{2});
+        CHECK(sorted_connections(pattern, 2) == std::vector<size_t>{0, 1});
+        CHECK(sorted_connections(pattern, 3) == std::vector<size_t>{3});
+        CHECK(pattern.edge_count() == 3);
+
+        // 색인 이후 추가/연결도 반영
+        const auto frozen = pattern.take_snapshot();
+        const size_t late = pattern.add_element(9);
+        CHECK(sorted_connections(pattern, late).empty());
+        pattern.connect(late, 0);
+        CHECK(sorted_connections(pattern, 0) == std::vector<size_t>{2, late});
+        CHECK(sorted_connections(frozen, 0) == std::vector<size_t>{2});
+
+        // 중복 허용 설정은 그대로 쌓인다
+        CHECK(pattern.connect(0, 2));
+        CHECK(sorted_connections(pattern, 2) == std::vector<size_t>{0, 0, 1});
+    }
+
+    TEST_CASE("Interleaved connect and visit keep the reverse index current") {
+        // 방문 순서까지 한 번에 만든 색인과 같아야 한다
+        auto visit_order = [](const auto& pattern, size_t index) {
+            std::vector<size_t> result;
+            pattern.visit_connections(index, [&result](size_t, size_t to, const auto&, const auto&) { result.push_back(to); });
+            return result;
+        };
+
+        constexpr size_t nodes = 300;
+        origami_composite<int> incremental("Incremental", undirected);
+        origami_composite<int> batch("Batch", undirected);
+        for (size_t i = 0; i < nodes; ++i) {
+            incremental.add_element(static_cast<int>(i));
+            batch.add_element(static_cast<int>(i));
+        }
+
+        std::mt19937 random{7};
+        std::uniform_int_distribution<size_t> pick(0, nodes - 1);
+        std::vector<size_t> frozen_expected;
+        decltype(incremental.take_snapshot()) frozen;
+        for (int step = 0; step < 2000; ++step) {
+            const size_t a = pick(random);
+            const size_t b = pick(random);
+            incremental.connect(a, b);
+            batch.connect(a, b);
+            CHECK(incremental.degree(b) == sorted_connections(incremental, b).size());
+            if (step == 1000) {
+                frozen = incremental.take_snapshot();
+                frozen_expected = visit_order(incremental, 17);
+            }
+        }
+
+        for (size_t i = 0; i < nodes; ++i) CHECK(visit_order(incremental, i) == visit_order(batch, i));
+        CHECK(visit_order(frozen, 17) == frozen_expected);
+    }
+
+    TEST_CASE("Unique edges reject duplicates in either direction") {
+        origami_composite<int> pattern("Unique", undirected_unique);
+        for (int i = 0; i < 5; ++i) pattern.add_element(i);
+        CHECK(pattern.connect(4, 1));
+        CHECK_FALSE(pattern.connect(1, 4));
+        CHECK_FALSE(pattern.connect(4, 1));
+        CHECK(pattern.connect(1, 0));
+        CHECK(pattern.connect(1, 3));
+        CHECK(pattern.edge_count() == 3);
+        CHECK(sorted_connections(pattern, 1) == std::vector<size_t>{0, 3, 4});
+
+        // 방향 모드에서도 같은 방향 연결만 거부
+        origami_composite<int> directed("Directed", edge_options{edge_mode::directed, true});
+        directed.add_element(0);
+        directed.add_element(1);
+        CHECK(directed.connect(0, 1));
+        CHECK_FALSE(directed.connect(0, 1));
+        CHECK(directed.connect(1, 0));
+
+        // 반복 생성해도 격자 위에 보정 연결이 쌓이지 않는다
+        origami_composite<int> implicit("Implicit", undirected_unique);
+        const size_t base = implicit.create_implicit_miura_pattern(4, 4);
+        CHECK_FALSE(implicit.connect(base, base + 1));
+        CHECK_FALSE(implicit.connect(base + 5, base));
+        CHECK(implicit.connect(base, base + 15));
+        CHECK_FALSE(implicit.connect(base + 15, base));
+        CHECK(implicit.edge_count() == miura_lattice(4, 4).edge_count() + 1);
+    }
+
+    TEST_CASE("Reordering keeps the smaller endpoint as owner") {
+        origami_composite<int> directed;
+        directed.create_miura_pattern(7, 6);
+
+        origami_composite<int> pattern("Reordered", undirected_unique);
+        pattern.add_element(-1);
+        const size_t base = pattern.create_implicit_miura_pattern(7, 6);
+        pattern.connect(0, base + 20);
+
+        std::vector<size_t> order;
+        for (size_t i = pattern.size(); i-- > 0;) order.push_back(i);
+        const auto new_index = pattern.reorder(order);
+
+        CHECK(pattern.edge_count() == miura_lattice(7, 6).edge_count() + 1);
+        pattern.for_each_edge([](size_t from, size_t to, const int&, const int&) { CHECK(from < to); });
+        CHECK(sorted_connections(pattern, new_index[0]) == std::vector<size_t>{new_index[base + 20]});
+        for (size_t i = 0; i < directed.size(); ++i) {
+            std::vector<size_t> expected;
+            for (size_t to : sorted_connections(directed, i)) expected.push_back(new_index[base + to]);
+            if (i == 20) expected.push_back(new_index[0]);
+            std::sort(expected.begin(), expected.end());
+            CHECK(sorted_connections(pattern, new_index[base + i]) == expected);
+        }
+    }
+}
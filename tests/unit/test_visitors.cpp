@@ -0,0 +1,159 @@
+/**
+ * @file tests/unit/test_visitors.cpp
+ * @brief 집계 캐시를 쓰는 visitor 들을 직접 트리 순회 결과와 비교하는 단위 테스트
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <origami/advanced_visitor.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace metaloki::origami;
+
+using int_leaf = leaf<int>;
+using text_leaf = leaf<std::string>;
+using chapter = composite<int_leaf, text_leaf>;
+using part = composite<int_leaf, chapter>;
+// 기본 composite<> 별칭이 아닌 인라인 용량 - visitor 오버로드가 basic_composite 전체를 받아야 한다
+using volume = basic_composite<8, int_leaf, text_leaf, chapter, part>;
+
+struct probe_element : visitable_base<probe_element, int> {};
+
+static_assert(Visitable<probe_element>);
+static_assert(!Visitable<int_leaf>);
+
+struct walk_totals {
+    size_t nodes = 0;
+    size_t int_leaves = 0;
+    long sum = 0;
+    size_t depth = 0;
+};
+
+// 집계 캐시 없이 모든 노드를 방문하는 기준 구현 (루트 깊이 = 1)
+template<typename Node>
+static void walk(const Node& node, size_t depth, walk_totals& totals) {
+    ++totals.nodes;
+    totals.depth = std::max(totals.depth, depth);
+    if constexpr (std::is_same_v<Node, int_leaf>) {
+        ++totals.int_leaves;
+        totals.sum += node.value();
+    } else if constexpr (requires { node.children(); }) {
+        for (const auto& child : node.children()) {
+            std::visit([&](const auto& element) { walk(element, depth + 1, totals); }, child);
+        }
+    }
+}
+
+static chapter make_chapter(int first, int count) {
+    chapter result("Chapter");
+    for (int i = 0; i < count; ++i) result.emplace<int_leaf>(first + i);
+    result.emplace<text_leaf>("note");
+    return result;
+}
+
+// volume { 1, "title", chapter{10..12, "note"}, part{ 4, chapter{20..23, "note"} } }
+static volume make_volume() {
+    volume result("Volume");
+    result.emplace<int_leaf>(1);
+    result.emplace<text_leaf>("title");
+    result.add(make_chapter(10, 3));
+
+    part nested("Part");
+    nested.emplace<int_leaf>(4);
+    nested.add(make_chapter(20, 4));
+    result.add(std::move(nested));
+    return result;
+}
+
+template<typename Tree>
+static void check_against_walk(const Tree& tree) {
+    walk_totals expected;
+    walk(tree, 1, expected);
+
+    accumulate_visitor<int> sum;
+    CHECK(sum.visit(tree) == expected.sum);
+    CHECK(sum.get_result() == expected.sum);
+
+    average_visitor<int> average;
+    average.visit(tree);
+    CHECK(average.get_sum() == expected.sum);
+    CHECK(average.get_count() == expected.int_leaves);
+    CHECK(average.get_average() == doctest::Approx(static_cast<double>(expected.sum) / expected.int_leaves));
+
+    node_counter_visitor counter;
+    CHECK(counter.visit(tree) == expected.nodes);
+    CHECK(counter.get_total_count() == expected.nodes);
+
+    depth_calculator_visitor depth;
+    CHECK(depth.visit(tree) == expected.depth);
+}
+
+TEST_SUITE("ORIGAMI visitors") {
+
+    TEST_CASE("Aggregate-backed visitors match a manual tree walk") {
+        const volume tree = make_volume();
+        check_against_walk(tree);
+        check_against_walk(make_chapter(5, 6));
+
+        walk_totals expected;
+        walk(tree, 1, expected);
+        CHECK(expected.nodes == 16);
+        CHECK(expected.depth == 4);
+    }
+
+    TEST_CASE("Visitors see changes made after an earlier visit") {
+        volume tree = make_volume();
+        check_against_walk(tree);
+
+        tree.emplace<int_leaf>(100);
+        check_against_walk(tree);
+
+        part deeper("Deeper");
+        deeper.add(make_chapter(-3, 2));
+        tree.add(std::move(deeper));
+        check_against_walk(tree);
+    }
+
+    TEST_CASE("Visitors accumulate across leaves and subtrees") {
+        const volume tree = make_volume();
+        walk_totals expected;
+        walk(tree, 1, expected);
+
+        accumulate_visitor<int> sum;
+        sum.visit(int_leaf(7));
+        sum.visit(tree);
+        CHECK(sum.get_result() == expected.sum + 7);
+
+        node_counter_visitor counter;
+        counter.visit(int_leaf(7));
+        counter.visit(tree);
+        CHECK(counter.get_total_count() == expected.nodes + 1);
+
+        depth_calculator_visitor depth;
+        CHECK(depth.visit(int_leaf(7)) == 1);
+        CHECK(depth.visit(tree) == expected.depth);
+    }
+
+    TEST_CASE("Tree visitor dispatches leaves to the derived visitor") {
+        chapter flat = make_chapter(1, 3);
+
+        for (auto mode : {tree_traversal_mode::depth_first_preorder, tree_traversal_mode::breadth_first}) {
+            collect_values_visitor<int> collector;
+            collector.set_traversal_mode(mode);
+
+            size_t before = 0;
+            size_t after = 0;
+            collector.set_pre_visit_hook([&before] { ++before; });
+            collector.set_post_visit_hook([&after] { ++after; });
+
+            collector.visit(flat);
+            const std::vector<std::vector<int>> expected{{1}, {2}, {3}, {}};
+            CHECK(collector.get_results() == expected);
+            CHECK(before == flat.children().size() + 1);
+            CHECK(after == before);
+        }
+    }
+}